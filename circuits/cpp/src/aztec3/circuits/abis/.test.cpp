@@ -1,7 +1,12 @@
 #include "index.hpp"
 #include "previous_kernel_data.hpp"
+#include "previous_kernel_data_view.hpp"
 
+#include "aztec3/circuits/abis/call_stack_item.hpp"
 #include "aztec3/circuits/abis/combined_accumulated_data.hpp"
+#include "aztec3/circuits/abis/hash_memo.hpp"
+#include "aztec3/circuits/abis/public_circuit_public_inputs.hpp"
+#include "aztec3/utils/msgpack_check_method.hpp"
 
 #include <barretenberg/common/serialize.hpp>
 #include <barretenberg/serialize/cbind.hpp>
@@ -27,7 +32,89 @@ TEST(abi_tests, msgpack_schema_smoke_test)
     // They will test for any bad serialization methods
     msgpack_schema_to_string(CombinedAccumulatedData<NT>{});
     CombinedAccumulatedData<NT> cad;
-    EXPECT_EQ(msgpack::check_msgpack_method(cad), "");
+    EXPECT_EQ(aztec3::utils::check_msgpack_method(cad), "");
+}
+
+TEST(abi_tests, msgpack_packs_fr_arrays_as_one_bin)
+{
+    using aztec3::utils::types::msgpack_packed;
+
+    std::array<NT::fr, 4> array = { NT::fr(1), NT::fr(2), NT::fr(-1), NT::fr::random_element() };
+
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, msgpack_packed(array));
+    msgpack::pack(buffer, array);
+
+    size_t offset = 0;
+    auto const packed_handle = msgpack::unpack(buffer.data(), buffer.size(), offset);
+    auto const plain_handle = msgpack::unpack(buffer.data(), buffer.size(), offset);
+
+    auto const& packed = packed_handle.get();
+    ASSERT_EQ(packed.type, msgpack::type::BIN);
+    EXPECT_EQ(packed.via.bin.size, 4U * 32U);
+    // each element is packed as `fr` packs itself
+    auto const* elements = reinterpret_cast<uint8_t const*>(packed.via.bin.ptr);
+    EXPECT_EQ(NT::fr::serialize_from_buffer(elements + 2 * 32), NT::fr(-1));
+    std::array<NT::fr, 4> unpacked{};
+    auto unpacked_proxy = msgpack_packed(unpacked);
+    packed.convert(unpacked_proxy);
+    EXPECT_EQ(unpacked, array);
+
+    // an array that is not wrapped keeps the default encoding of msgpack
+    EXPECT_EQ(plain_handle.get().type, msgpack::type::ARRAY);
+    EXPECT_EQ(plain_handle.get().via.array.size, 4U);
+
+    // the wrapped fields of a struct round trip through its msgpack method
+    CombinedAccumulatedData<NT> data;
+    data.new_commitments[1] = NT::fr::random_element();
+    data.public_call_stack[0] = NT::fr::random_element();
+    msgpack::sbuffer data_buffer;
+    msgpack::pack(data_buffer, data);
+    EXPECT_EQ(msgpack::unpack(data_buffer.data(), data_buffer.size()).get().as<CombinedAccumulatedData<NT>>(), data);
+
+    EXPECT_NE(msgpack_schema_to_string(data).find("packed_array"), std::string::npos);
+    // the proxies stand for the arrays they refer to
+    EXPECT_EQ(aztec3::utils::check_msgpack_method(PublicCircuitPublicInputs<NT>{}), "");
+}
+
+TEST(abi_tests, native_compress_matches_pedersen_commitment)
+{
+    // includes the extremes of each window: zero, the largest field element and the top bit
+    std::array<NT::fr, 5> const inputs = {
+        NT::fr::random_element(), NT::fr(0), NT::fr(-1), NT::fr(uint256_t(1) << 253), NT::fr::random_element(),
+    };
+    std::vector<NT::fr> const inputs_vec(inputs.begin(), inputs.end());
+
+    for (size_t const hash_index : std::array<size_t, 3>{ 0, GeneratorIndex::OUTER_COMMITMENT, GeneratorIndex::VK }) {
+        auto const expected = crypto::pedersen_commitment::compress_native(inputs_vec, hash_index);
+        EXPECT_EQ(NT::compress(inputs, hash_index), expected);
+        EXPECT_EQ(NT::compress(inputs_vec, hash_index), expected);
+    }
+}
+
+TEST(abi_tests, native_merkle_hash_batch_matches_merkle_hash)
+{
+    // more pairs than a batch (see batched_pedersen_lookup.hpp), with the extremes of a field element among them
+    constexpr size_t NUM_PAIRS = 2 * utils::types::batched_pedersen_lookup::BATCH_SIZE + 3;
+    std::vector<NT::fr> children(2 * NUM_PAIRS);
+    for (auto& child : children) {
+        child = NT::fr::random_element();
+    }
+    children[2] = children[3] = NT::fr(0);
+    children[4] = NT::fr(-1);
+    children[5] = NT::fr(uint256_t(1) << 253);
+
+    std::vector<NT::fr> hashes(NUM_PAIRS);
+    NT::merkle_hash_batch(children, hashes);
+    for (size_t i = 0; i < NUM_PAIRS; i++) {
+        EXPECT_EQ(hashes[i], crypto::pedersen_hash::lookup::hash_multiple({ children[2 * i], children[2 * i + 1] }, 0));
+    }
+
+    // hashing a layer in place, over its own front, gives the same hashes
+    NT::merkle_hash_batch(children, std::span<NT::fr>(children.data(), NUM_PAIRS));
+    EXPECT_EQ(std::vector<NT::fr>(children.begin(), children.begin() + NUM_PAIRS), hashes);
+
+    NT::merkle_hash_batch({}, {});
 }
 
 TEST(abi_tests, native_read_write_call_context)
@@ -112,4 +199,71 @@ TEST(abi_tests, native_to_circuit_call_context)
     info("call context: ", circuit_call_context);
 }
 
+TEST(abi_tests, native_previous_kernel_data_view_skips_the_vk)
+{
+    // commitments with names of different lengths, and a recursive proof, so that every length of the key is skipped
+    NT::VKData vk_data = { .composer_type = 2,
+                           .circuit_size = 1024,
+                           .num_public_inputs = 7,
+                           .commitments = {},
+                           .contains_recursive_proof = true,
+                           .recursive_proof_public_input_indices = { 1, 2, 3, 4 } };
+    vk_data.commitments["Q_1"] = barretenberg::g1::affine_one;
+    vk_data.commitments["SIGMA_1"] = barretenberg::g1::affine_one;
+    vk_data.commitments["TABLE_TYPE"] = barretenberg::g1::affine_one;
+    auto const env_crs = std::make_unique<proof_system::EnvReferenceStringFactory>();
+
+    PreviousKernelData<NT> kernel_data{};
+    kernel_data.public_inputs.end.new_commitments[0] = NT::fr(42);
+    kernel_data.proof.proof_data = { 1, 2, 3 };
+    kernel_data.vk = std::make_shared<NT::VK>(std::move(vk_data), env_crs->get_verifier_crs());
+    kernel_data.vk_index = 5;
+    kernel_data.vk_path[0] = NT::fr(6);
+
+    std::vector<uint8_t> vk_vec;
+    write(vk_vec, *kernel_data.vk);
+    std::vector<uint8_t> kernel_data_vec;
+    write(kernel_data_vec, kernel_data);
+
+    uint8_t const* it = kernel_data_vec.data();
+    PreviousKernelDataView view;
+    read(it, view);
+    ASSERT_EQ(it, kernel_data_vec.data() + kernel_data_vec.size());
+
+    EXPECT_EQ(view.public_inputs, kernel_data.public_inputs);
+    EXPECT_EQ(std::vector<uint8_t>(view.proof.begin(), view.proof.end()), kernel_data.proof.proof_data);
+    EXPECT_EQ(std::vector<uint8_t>(view.vk_buf.begin(), view.vk_buf.end()), vk_vec);
+    EXPECT_EQ(view.vk_index, kernel_data.vk_index);
+    EXPECT_EQ(view.vk_path, kernel_data.vk_path);
+
+    std::vector<uint8_t> view_vk_vec;
+    write(view_vk_vec, *view.vk());
+    EXPECT_EQ(view_vk_vec, vk_vec);
+}
+
+TEST(abi_tests, native_hash_memo_hashes_equal_items_once)
+{
+    CallStackItem<NT, PublicTypes> item;
+    item.contract_address = NT::fr(1);
+    item.public_inputs.args[0] = NT::fr(2);
+    CallStackItem<NT, PublicTypes> other_item = item;
+    other_item.public_inputs.args[0] = NT::fr(3);
+
+    HashMemo<CallStackItem<NT, PublicTypes>> hashes(1);
+    EXPECT_EQ(hashes.hash(item), item.hash());
+    EXPECT_EQ(hashes.hash(item), item.hash());
+    EXPECT_EQ(hashes.get_num_hits(), 1U);
+
+    // an item changed since it was memoised is hashed again, and evicts the item of a full memo
+    EXPECT_EQ(hashes.hash(other_item), other_item.hash());
+    EXPECT_EQ(hashes.hash(item), item.hash());
+    EXPECT_EQ(hashes.get_num_hits(), 1U);
+
+    // the public inputs alone
+    HashMemo<PublicCircuitPublicInputs<NT>> public_inputs_hashes(1);
+    EXPECT_EQ(public_inputs_hashes.hash(item.public_inputs), item.public_inputs.hash());
+    EXPECT_EQ(public_inputs_hashes.hash(item.public_inputs), item.public_inputs.hash());
+    EXPECT_EQ(public_inputs_hashes.get_num_hits(), 1U);
+}
+
 }  // namespace aztec3::circuits::abis
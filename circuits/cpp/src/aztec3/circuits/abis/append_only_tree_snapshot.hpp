@@ -1,5 +1,6 @@
 #pragma once
 
+#include "aztec3/utils/serialized_size.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 
 #include <barretenberg/serialize/msgpack.hpp>
@@ -29,12 +30,17 @@ template <typename NCT> void read(uint8_t const*& it, AppendOnlyTreeSnapshot<NCT
     read(it, obj.next_available_leaf_index);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, AppendOnlyTreeSnapshot<NCT> const& obj)
+template <typename NCT> void write(uint8_t*& it, AppendOnlyTreeSnapshot<NCT> const& obj)
 {
     using serialize::write;
 
-    write(buf, obj.root);
-    write(buf, obj.next_available_leaf_index);
+    write(it, obj.root);
+    write(it, obj.next_available_leaf_index);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, AppendOnlyTreeSnapshot<NCT> const& obj)
+{
+    aztec3::utils::append_fixed(buf, obj);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, AppendOnlyTreeSnapshot<NCT> const& obj)
@@ -43,4 +49,11 @@ template <typename NCT> std::ostream& operator<<(std::ostream& os, AppendOnlyTre
               << "next_available_leaf_index: " << obj.next_available_leaf_index << "\n";
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::AppendOnlyTreeSnapshot<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::uint32> {};
+
+}  // namespace aztec3::utils
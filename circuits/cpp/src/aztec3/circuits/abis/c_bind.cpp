@@ -180,7 +180,7 @@ WASM_EXPORT void abis__hash_vk(uint8_t const* vk_data_buf, uint8_t* output)
     NT::VKData vk_data;
     read(vk_data_buf, vk_data);
 
-    NT::fr::serialize_to_buffer(vk_data.compress_native(aztec3::GeneratorIndex::VK), output);
+    NT::fr::serialize_to_buffer(aztec3::circuits::compute_vk_hash(vk_data), output);
 }
 
 /**
@@ -355,6 +355,56 @@ WASM_EXPORT void abis__compute_message_secret_hash(uint8_t const* secret, uint8_
     NT::fr::serialize_to_buffer(secret_hash, output);
 }
 
+namespace {
+/**
+ * @brief Hit, miss and eviction counts of the process-wide caches of native hashes, to tune their capacity
+ */
+struct HashCacheStats {
+    aztec3::utils::LruCacheStats public_data_tree_index;
+    aztec3::utils::LruCacheStats silo;
+    aztec3::utils::LruCacheStats vk;
+
+    MSGPACK_FIELDS(public_data_tree_index, silo, vk);
+};
+
+/**
+ * @brief The number of entries of each process-wide cache of native hashes
+ *
+ * @details Set apart, as their entries differ in size: an entry of a compression cache is a few field elements, while
+ * an entry of the verification key hash cache holds a whole serialized key (about 2KB).
+ */
+struct HashCacheCapacities {
+    uint32_t public_data_tree_index = aztec3::circuits::DEFAULT_COMPRESSION_CACHE_CAPACITY;
+    uint32_t silo = aztec3::circuits::DEFAULT_COMPRESSION_CACHE_CAPACITY;
+    uint32_t vk = aztec3::circuits::DEFAULT_VK_HASH_CACHE_CAPACITY;
+
+    MSGPACK_FIELDS(public_data_tree_index, silo, vk);
+};
+
+HashCacheStats get_hash_cache_stats()
+{
+    return {
+        .public_data_tree_index = aztec3::circuits::get_public_data_tree_index_cache().get_stats(),
+        .silo = aztec3::circuits::get_silo_cache().get_stats(),
+        .vk = aztec3::circuits::get_vk_hash_cache().get_stats(),
+    };
+}
+
+HashCacheStats set_hash_cache_capacities(HashCacheCapacities capacities)
+{
+    aztec3::circuits::get_public_data_tree_index_cache().set_capacity(capacities.public_data_tree_index);
+    aztec3::circuits::get_silo_cache().set_capacity(capacities.silo);
+    aztec3::circuits::get_vk_hash_cache().set_capacity(capacities.vk);
+    return get_hash_cache_stats();
+}
+}  // namespace
+
+CBIND(abis__get_hash_cache_stats, get_hash_cache_stats);
+
+// Sets the number of entries of each cache of native hashes (evicting the least recently used ones of a cache
+// that is too large), and returns their stats
+CBIND(abis__set_hash_cache_capacity, set_hash_cache_capacities);
+
 /* Typescript test helpers that call as_string_output() to stress serialization.
  * Each of these take an object buffer, and a string size pointer.
  * They return a string pointer (to be bbfree'd) and write to the string size pointer. */
@@ -28,3 +28,6 @@ WASM_EXPORT void abis__compute_contract_leaf(uint8_t const* contract_leaf_preima
 WASM_EXPORT void abis__compute_transaction_hash(uint8_t const* signed_tx_request_buf, uint8_t* output);
 WASM_EXPORT void abis__compute_call_stack_item_hash(uint8_t const* call_stack_item_buf, uint8_t* output);
 
+CBIND_DECL(abis__get_hash_cache_stats);
+CBIND_DECL(abis__set_hash_cache_capacity);
+
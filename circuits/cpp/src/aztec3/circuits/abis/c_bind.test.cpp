@@ -1,16 +1,27 @@
+#include "append_only_tree_snapshot.hpp"
 #include "c_bind.h"
+#include "contract_storage_read.hpp"
+#include "contract_storage_update_request.hpp"
 #include "function_leaf_preimage.hpp"
+#include "membership_witness.hpp"
+#include "public_data_read.hpp"
+#include "public_data_update_request.hpp"
 #include "tx_request.hpp"
 
 #include "aztec3/circuits/abis/new_contract_data.hpp"
+#include "aztec3/circuits/abis/rollup/nullifier_leaf_preimage.hpp"
 #include "aztec3/circuits/abis/signed_tx_request.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/utils/serialized_size.hpp"
 
 #include <barretenberg/common/serialize.hpp>
 #include <barretenberg/numeric/random/engine.hpp>
 #include <barretenberg/serialize/test_helper.hpp>
 #include <barretenberg/stdlib/merkle_tree/membership.hpp>
 
+#include <algorithm>
+#include <span>
+
 #include <gtest/gtest.h>
 
 namespace {
@@ -45,6 +56,30 @@ template <size_t NUM_BYTES> std::string bytes_to_hex_str(std::array<uint8_t, NUM
     return stream.str();
 }
 
+/**
+ * @brief Check that `write(uint8_t*& it, value)` writes exactly `serialized_size<T>()` bytes, and `read` reads them
+ * back
+ */
+template <typename T> void expect_serialized_size_matches_write(T const& value)
+{
+    constexpr size_t size = aztec3::utils::serialized_size<T>();
+    // room past the end, to see a write overrunning the size
+    constexpr uint8_t canary = 0xa5;
+    std::vector<uint8_t> buf(size + 64, canary);
+    uint8_t* it = buf.data();
+    write(it, value);
+    EXPECT_EQ(static_cast<size_t>(it - buf.data()), size);
+    EXPECT_TRUE(std::all_of(buf.begin() + static_cast<std::ptrdiff_t>(size), buf.end(), [](uint8_t byte) {
+        return byte == canary;
+    }));
+
+    T value_read;
+    uint8_t const* read_it = buf.data();
+    read(read_it, value_read);
+    EXPECT_EQ(static_cast<size_t>(read_it - buf.data()), size);
+    EXPECT_EQ(value_read, value);
+}
+
 }  // namespace
 
 namespace aztec3::circuits::abis {
@@ -56,6 +91,123 @@ TEST(abi_tests, compute_contract_address)
         call_func_and_wrapper(func, abis__compute_contract_address, NT::address(1), NT::fr(2), NT::fr(3), NT::fr(4));
     EXPECT_EQ(actual, expected);
 }
+TEST(abi_tests, cached_native_compressions_match_compress_native)
+{
+    NT::address const contract_address = NT::address(NT::fr::random_element());
+    NT::fr const value = NT::fr::random_element();
+    auto const compress = [](NT::fr const& left, NT::fr const& right, size_t hash_index) {
+        return crypto::pedersen_commitment::compress_native({ left, right }, hash_index);
+    };
+
+    auto const start_stats = aztec3::circuits::get_silo_cache().get_stats();
+    for (size_t i = 0; i < 2; i++) {
+        EXPECT_EQ(aztec3::circuits::silo_commitment<NT>(contract_address, value),
+                  compress(contract_address.to_field(), value, GeneratorIndex::OUTER_COMMITMENT));
+        EXPECT_EQ(aztec3::circuits::silo_nullifier<NT>(contract_address, value),
+                  compress(contract_address.to_field(), value, GeneratorIndex::OUTER_NULLIFIER));
+        EXPECT_EQ(aztec3::circuits::compute_public_data_tree_index<NT>(contract_address.to_field(), value),
+                  compress(contract_address.to_field(), value, GeneratorIndex::PUBLIC_LEAF_INDEX));
+    }
+    // the commitment and the nullifier are cached apart, and each is only computed once
+    auto const stats = aztec3::circuits::get_silo_cache().get_stats();
+    EXPECT_EQ(stats.misses - start_stats.misses, 2U);
+    EXPECT_EQ(stats.hits - start_stats.hits, 2U);
+}
+
+TEST(abi_tests, hash_cache_evicts_least_recently_used)
+{
+    aztec3::utils::ShardedLruCache<int, int, std::hash<int>, 1> cache(2);
+    size_t num_computed = 0;
+    auto const get = [&](int key) {
+        return cache.get_or_compute(key, [&] {
+            num_computed++;
+            return key * 10;
+        });
+    };
+
+    EXPECT_EQ(get(1), 10);
+    EXPECT_EQ(get(2), 20);
+    EXPECT_EQ(get(1), 10);
+    // 2 is now the least recently used
+    EXPECT_EQ(get(3), 30);
+    EXPECT_EQ(get(1), 10);
+    EXPECT_EQ(get(2), 20);
+    EXPECT_EQ(num_computed, 4U);
+    EXPECT_EQ(cache.get_stats(),
+              (aztec3::utils::LruCacheStats{ .hits = 2, .misses = 4, .evictions = 2, .size = 2, .capacity = 2 }));
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.get_stats().evictions, 3U);
+    EXPECT_EQ(get(2), 20);
+    EXPECT_EQ(num_computed, 4U);
+}
+
+TEST(abi_tests, write_fixed_matches_field_by_field_write)
+{
+    using aztec3::utils::serialized_size;
+
+    static_assert(serialized_size<MembershipWitness<NT, 4>>() == 5 * 32);
+    static_assert(serialized_size<FunctionData<NT>>() == 4 + 1 + 1);
+    static_assert(!aztec3::utils::FixedSizeSerializable<std::vector<NT::fr>>);
+
+    MembershipWitness<NT, 4> witness{ .leaf_index = 3 };
+    for (size_t i = 0; i < 4; i++) {
+        witness.sibling_path[i] = NT::fr::random_element(&engine);
+    }
+
+    // the fields written one by one to a growing vector, as `write` did before the fixed-size encoding
+    std::vector<uint8_t> expected;
+    serialize::write(expected, witness.leaf_index);
+    serialize::write(expected, witness.sibling_path);
+    EXPECT_EQ(expected.size(), serialized_size<MembershipWitness<NT, 4>>());
+
+    std::array<uint8_t, serialized_size<MembershipWitness<NT, 4>>()> encoded{};
+    aztec3::utils::write_fixed<MembershipWitness<NT, 4>>(encoded, witness);
+    EXPECT_EQ(std::vector<uint8_t>(encoded.begin(), encoded.end()), expected);
+
+    // `write` to a vector appends at the end of what it holds
+    FunctionData<NT> const function_data{ .function_selector = 7, .is_private = true };
+    std::vector<uint8_t> buf;
+    write(buf, function_data);
+    write(buf, witness);
+    EXPECT_EQ(buf.size(), serialized_size<FunctionData<NT>>() + expected.size());
+    EXPECT_EQ(std::vector<uint8_t>(buf.begin() + 6, buf.end()), expected);
+
+    uint8_t const* it = buf.data();
+    FunctionData<NT> function_data_read;
+    MembershipWitness<NT, 4> witness_read;
+    read(it, function_data_read);
+    read(it, witness_read);
+    EXPECT_EQ(function_data_read, function_data);
+    EXPECT_EQ(witness_read, witness);
+}
+
+TEST(abi_tests, serialized_size_matches_write)
+{
+    auto const random_fr = [] { return NT::fr::random_element(&engine); };
+
+    expect_serialized_size_matches_write(
+        AppendOnlyTreeSnapshot<NT>{ .root = random_fr(), .next_available_leaf_index = engine.get_random_uint32() });
+
+    MembershipWitness<NT, 4> witness{ .leaf_index = random_fr() };
+    for (auto& sibling : witness.sibling_path) {
+        sibling = random_fr();
+    }
+    expect_serialized_size_matches_write(witness);
+
+    expect_serialized_size_matches_write(NullifierLeafPreimage<NT>{
+        .leaf_value = random_fr(), .next_index = engine.get_random_uint32(), .next_value = random_fr() });
+    expect_serialized_size_matches_write(PublicDataRead<NT>{ .leaf_index = random_fr(), .value = random_fr() });
+    expect_serialized_size_matches_write(
+        PublicDataUpdateRequest<NT>{ .leaf_index = random_fr(), .old_value = random_fr(), .new_value = random_fr() });
+    expect_serialized_size_matches_write(
+        ContractStorageRead<NT>{ .storage_slot = random_fr(), .current_value = random_fr() });
+    expect_serialized_size_matches_write(ContractStorageUpdateRequest<NT>{
+        .storage_slot = random_fr(), .old_value = random_fr(), .new_value = random_fr() });
+    expect_serialized_size_matches_write(FunctionData<NT>{
+        .function_selector = engine.get_random_uint32(), .is_private = true, .is_constructor = true });
+}
+
 TEST(abi_tests, hash_tx_request)
 {
     // randomize function args for tx request
@@ -151,6 +303,12 @@ TEST(abi_tests, hash_vk)
 
     // Confirm cbind output == expected hash
     EXPECT_EQ(got_hash, expected_hash);
+
+    // the hash of a key already hashed is served from the cache
+    auto const start_stats = aztec3::circuits::get_vk_hash_cache().get_stats();
+    abis__hash_vk(vk_data_vec.data(), output.data());
+    EXPECT_EQ(NT::fr::serialize_from_buffer(output.data()), expected_hash);
+    EXPECT_EQ(aztec3::circuits::get_vk_hash_cache().get_stats().hits - start_stats.hits, 1U);
 }
 
 TEST(abi_tests, compute_function_leaf)
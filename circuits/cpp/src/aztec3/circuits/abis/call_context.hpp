@@ -74,7 +74,7 @@ template <typename NCT> struct CallContext {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 6> const inputs = {
             msg_sender.to_field(), storage_contract_address.to_field(), portal_contract_address, fr(is_delegate_call),
             fr(is_static_call),    fr(is_contract_deployment),
         };
@@ -1,5 +1,6 @@
 #pragma once
 #include "function_data.hpp"
+#include "hash_memo.hpp"
 #include "kernel_circuit_public_inputs.hpp"
 #include "private_circuit_public_inputs.hpp"
 #include "public_circuit_public_inputs.hpp"
@@ -38,7 +39,7 @@ template <typename NCT, template <class> typename PrivatePublic> struct CallStac
 
     // for serialization, update with new fields
     MSGPACK_FIELDS(contract_address, function_data, public_inputs, is_execution_request);
-    boolean operator==(CallContext<NCT> const& other) const
+    boolean operator==(CallStackItem<NCT, PrivatePublic> const& other) const
     {
         return contract_address == other.contract_address && function_data == other.function_data &&
                public_inputs == other.public_inputs && is_execution_request == other.is_execution_request;
@@ -64,7 +65,7 @@ template <typename NCT, template <class> typename PrivatePublic> struct CallStac
 
     fr hash() const
     {
-        const std::vector<fr> inputs = {
+        const std::array<fr, 3> inputs = {
             contract_address.to_field(),
             function_data.hash(),
             public_inputs.hash(),
@@ -133,4 +134,14 @@ inline fr get_call_stack_item_hash(abis::CallStackItem<NativeTypes, PublicTypes>
     return preimage.hash();
 }
 
+// Same as get_call_stack_item_hash(call_stack_item), with the hash memoised in `hashes`
+inline fr get_call_stack_item_hash(abis::CallStackItem<NativeTypes, PublicTypes> const& call_stack_item,
+                                   HashMemo<abis::CallStackItem<NativeTypes, PublicTypes>>& hashes)
+{
+    if (call_stack_item.is_execution_request) {
+        return hashes.hash(as_execution_request(call_stack_item));
+    }
+    return hashes.hash(call_stack_item);
+}
+
 }  // namespace aztec3::circuits::abis
\ No newline at end of file
@@ -17,6 +17,8 @@ namespace aztec3::circuits::abis {
 
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
+using aztec3::utils::types::msgpack_fields;
+using aztec3::utils::types::msgpack_packed;
 using aztec3::utils::types::NativeTypes;
 using std::is_same;
 
@@ -45,16 +47,30 @@ template <typename NCT> struct CombinedAccumulatedData {
     std::array<PublicDataRead<NCT>, KERNEL_PUBLIC_DATA_READS_LENGTH> public_data_reads{};
 
     // for serialization, update with new fields
-    MSGPACK_FIELDS(aggregation_object,
-                   new_commitments,
-                   new_nullifiers,
-                   private_call_stack,
-                   public_call_stack,
-                   new_l2_to_l1_msgs,
-                   new_contracts,
-                   optionally_revealed_data,
-                   public_data_update_requests,
-                   public_data_reads);
+    void msgpack(auto pack_fn)
+    {
+        msgpack_fields(pack_fn,
+                       "aggregation_object",
+                       aggregation_object,
+                       "new_commitments",
+                       msgpack_packed(new_commitments),
+                       "new_nullifiers",
+                       msgpack_packed(new_nullifiers),
+                       "private_call_stack",
+                       msgpack_packed(private_call_stack),
+                       "public_call_stack",
+                       msgpack_packed(public_call_stack),
+                       "new_l2_to_l1_msgs",
+                       msgpack_packed(new_l2_to_l1_msgs),
+                       "new_contracts",
+                       new_contracts,
+                       "optionally_revealed_data",
+                       optionally_revealed_data,
+                       "public_data_update_requests",
+                       public_data_update_requests,
+                       "public_data_reads",
+                       public_data_reads);
+    }
     boolean operator==(CombinedAccumulatedData<NCT> const& other) const
     {
         return aggregation_object == other.aggregation_object && new_commitments == other.new_commitments &&
@@ -90,7 +90,7 @@ template <typename NCT> struct ContractDeploymentData {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 4> const inputs = {
             constructor_vk_hash,
             function_tree_root,
             contract_address_salt,
@@ -1,5 +1,6 @@
 #pragma once
 #include <aztec3/utils/msgpack_derived_output.hpp>
+#include <aztec3/utils/serialized_size.hpp>
 #include <aztec3/utils/types/circuit_types.hpp>
 #include <aztec3/utils/types/convert.hpp>
 #include <aztec3/utils/types/native_types.hpp>
@@ -55,7 +56,7 @@ template <typename NCT> struct ContractStorageRead {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 2> const inputs = {
             storage_slot,
             current_value,
         };
@@ -82,12 +83,17 @@ template <typename NCT> void read(uint8_t const*& it, ContractStorageRead<NCT>&
     read(it, contract_storage_read.current_value);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, ContractStorageRead<NCT> const& contract_storage_read)
+template <typename NCT> void write(uint8_t*& it, ContractStorageRead<NCT> const& contract_storage_read)
 {
     using serialize::write;
 
-    write(buf, contract_storage_read.storage_slot);
-    write(buf, contract_storage_read.current_value);
+    write(it, contract_storage_read.storage_slot);
+    write(it, contract_storage_read.current_value);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, ContractStorageRead<NCT> const& contract_storage_read)
+{
+    aztec3::utils::append_fixed(buf, contract_storage_read);
 };
 
 template <typename NCT>
@@ -98,3 +104,10 @@ std::ostream& operator<<(std::ostream& os, ContractStorageRead<NCT> const& contr
 }
 
 }  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::ContractStorageRead<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::fr> {};
+
+}  // namespace aztec3::utils
@@ -1,5 +1,6 @@
 #pragma once
 #include <aztec3/utils/msgpack_derived_output.hpp>
+#include <aztec3/utils/serialized_size.hpp>
 #include <aztec3/utils/types/circuit_types.hpp>
 #include <aztec3/utils/types/convert.hpp>
 #include <aztec3/utils/types/native_types.hpp>
@@ -58,7 +59,7 @@ template <typename NCT> struct ContractStorageUpdateRequest {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 3> const inputs = {
             storage_slot,
             old_value,
             new_value,
@@ -88,13 +89,18 @@ template <typename NCT> void read(uint8_t const*& it, ContractStorageUpdateReque
     read(it, update_request.new_value);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, ContractStorageUpdateRequest<NCT> const& update_request)
+template <typename NCT> void write(uint8_t*& it, ContractStorageUpdateRequest<NCT> const& update_request)
 {
     using serialize::write;
 
-    write(buf, update_request.storage_slot);
-    write(buf, update_request.old_value);
-    write(buf, update_request.new_value);
+    write(it, update_request.storage_slot);
+    write(it, update_request.old_value);
+    write(it, update_request.new_value);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, ContractStorageUpdateRequest<NCT> const& update_request)
+{
+    aztec3::utils::append_fixed(buf, update_request);
 };
 
 template <typename NCT>
@@ -104,4 +110,11 @@ std::ostream& operator<<(std::ostream& os, ContractStorageUpdateRequest<NCT> con
     return os;
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::ContractStorageUpdateRequest<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::fr, types::NativeTypes::fr> {};
+
+}  // namespace aztec3::utils
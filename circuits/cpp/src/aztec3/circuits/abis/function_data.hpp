@@ -1,5 +1,6 @@
 #pragma once
 #include <aztec3/constants.hpp>
+#include <aztec3/utils/serialized_size.hpp>
 #include <aztec3/utils/types/circuit_types.hpp>
 #include <aztec3/utils/types/convert.hpp>
 #include <aztec3/utils/types/native_types.hpp>
@@ -70,7 +71,7 @@ template <typename NCT> struct FunctionData {
     // TODO: this can all be packed into 1 field element, so this `hash` function should just return that field element.
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 3> const inputs = {
             fr(function_selector),
             fr(is_private),
             fr(is_constructor),
@@ -89,13 +90,18 @@ template <typename NCT> void read(uint8_t const*& it, FunctionData<NCT>& functio
     read(it, function_data.is_constructor);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, FunctionData<NCT> const& function_data)
+template <typename NCT> void write(uint8_t*& it, FunctionData<NCT> const& function_data)
 {
     using serialize::write;
 
-    write(buf, function_data.function_selector);
-    write(buf, function_data.is_private);
-    write(buf, function_data.is_constructor);
+    write(it, function_data.function_selector);
+    write(it, function_data.is_private);
+    write(it, function_data.is_constructor);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, FunctionData<NCT> const& function_data)
+{
+    aztec3::utils::append_fixed(buf, function_data);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, FunctionData<NCT> const& function_data)
@@ -105,4 +111,11 @@ template <typename NCT> std::ostream& operator<<(std::ostream& os, FunctionData<
               << "is_constructor: " << function_data.is_constructor << "\n";
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::FunctionData<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::uint32, types::NativeTypes::boolean, types::NativeTypes::boolean> {};
+
+}  // namespace aztec3::utils
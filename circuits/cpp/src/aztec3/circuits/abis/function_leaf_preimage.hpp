@@ -85,7 +85,7 @@ template <typename NCT> struct FunctionLeafPreimage {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 4> const inputs = {
             function_selector,
             fr(is_private),
             vk_hash,
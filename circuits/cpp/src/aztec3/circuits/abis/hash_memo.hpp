@@ -0,0 +1,69 @@
+#pragma once
+
+#include <aztec3/utils/types/native_types.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace aztec3::circuits::abis {
+
+using aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief The hashes of the last native abis values (`CallStackItem`, `PrivateCircuitPublicInputs` or
+ * `PublicCircuitPublicInputs`) hashed through it, so that hashing one of them again costs a comparison
+ *
+ * @details The kernels hash a call stack item in two iterations: as a preimage of the call stack of its caller, then
+ * as the call of its own iteration. A memo held from one iteration to the next (by `native_public_kernel_tx`, or a
+ * `PrivateKernelSession`) hashes it once. Values are looked up by equality with a copy of those memoised: a value
+ * changed since it was hashed is hashed again, so no entry ever has to be invalidated.
+ *
+ * Not thread-safe: each sequence of iterations holds its own.
+ */
+template <typename T> class HashMemo {
+  public:
+    /**
+     * @param capacity The number of values memoised, the least recently used being dropped first. A memo of capacity 0
+     * memoises nothing.
+     */
+    explicit HashMemo(size_t capacity) : capacity(capacity) { entries.reserve(capacity); }
+
+    /**
+     * @brief Same as `value.hash()`, only computed if no equal value is memoised
+     */
+    NativeTypes::fr hash(T const& value)
+    {
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->first == value) {
+                num_hits++;
+                auto entry = std::move(*it);
+                entries.erase(it);
+                entries.push_back(std::move(entry));
+                return entries.back().second;
+            }
+        }
+
+        auto const value_hash = value.hash();
+        if (capacity > 0) {
+            if (entries.size() == capacity) {
+                entries.erase(entries.begin());
+            }
+            entries.emplace_back(value, value_hash);
+        }
+        return value_hash;
+    }
+
+    /**
+     * @brief The number of hashes that were memoised rather than computed
+     */
+    size_t get_num_hits() const { return num_hits; }
+
+  private:
+    size_t capacity;
+    // least recently used first
+    std::vector<std::pair<T, NativeTypes::fr>> entries;
+    size_t num_hits = 0;
+};
+
+}  // namespace aztec3::circuits::abis
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "aztec3/utils/serialized_size.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 #include "aztec3/utils/types/convert.hpp"
 #include <aztec3/utils/array.hpp>
@@ -47,12 +48,17 @@ template <typename NCT, unsigned int N> void read(uint8_t const*& it, Membership
     read(it, obj.sibling_path);
 };
 
-template <typename NCT, unsigned int N> void write(std::vector<uint8_t>& buf, MembershipWitness<NCT, N> const& obj)
+template <typename NCT, unsigned int N> void write(uint8_t*& it, MembershipWitness<NCT, N> const& obj)
 {
     using serialize::write;
 
-    write(buf, obj.leaf_index);
-    write(buf, obj.sibling_path);
+    write(it, obj.leaf_index);
+    write(it, obj.sibling_path);
+};
+
+template <typename NCT, unsigned int N> void write(std::vector<uint8_t>& buf, MembershipWitness<NCT, N> const& obj)
+{
+    aztec3::utils::append_fixed(buf, obj);
 };
 
 template <typename NCT, unsigned int N> std::ostream& operator<<(std::ostream& os, MembershipWitness<NCT, N> const& obj)
@@ -61,4 +67,11 @@ template <typename NCT, unsigned int N> std::ostream& operator<<(std::ostream& o
               << "sibling_path: " << obj.sibling_path << "\n";
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <unsigned int N> struct SerializedSize<circuits::abis::MembershipWitness<types::NativeTypes, N>>
+    : SerializedSizeOf<types::NativeTypes::fr, std::array<types::NativeTypes::fr, N>> {};
+
+}  // namespace aztec3::utils
@@ -74,7 +74,7 @@ template <typename NCT> struct NewContractData {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 3> const inputs = {
             fr(contract_address),
             fr(portal_contract_address),
             fr(function_tree_root),
@@ -11,6 +11,8 @@ namespace aztec3::circuits::abis {
 
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
+using aztec3::utils::types::msgpack_fields;
+using aztec3::utils::types::msgpack_packed;
 using aztec3::utils::types::NativeTypes;
 
 template <typename NCT> struct OptionallyRevealedData {
@@ -29,15 +31,28 @@ template <typename NCT> struct OptionallyRevealedData {
     boolean called_from_public_l2 = false;
 
     // for serialization: update up with new fields
-    MSGPACK_FIELDS(call_stack_item_hash,
-                   function_data,
-                   emitted_events,
-                   vk_hash,
-                   portal_contract_address,
-                   pay_fee_from_l1,
-                   pay_fee_from_public_l2,
-                   called_from_l1,
-                   called_from_public_l2);
+    void msgpack(auto pack_fn)
+    {
+        msgpack_fields(pack_fn,
+                       "call_stack_item_hash",
+                       call_stack_item_hash,
+                       "function_data",
+                       function_data,
+                       "emitted_events",
+                       msgpack_packed(emitted_events),
+                       "vk_hash",
+                       vk_hash,
+                       "portal_contract_address",
+                       portal_contract_address,
+                       "pay_fee_from_l1",
+                       pay_fee_from_l1,
+                       "pay_fee_from_public_l2",
+                       pay_fee_from_public_l2,
+                       "called_from_l1",
+                       called_from_l1,
+                       "called_from_public_l2",
+                       called_from_public_l2);
+    }
     boolean operator==(OptionallyRevealedData<NCT> const& other) const
     {
         return call_stack_item_hash == other.call_stack_item_hash && function_data == other.function_data &&
@@ -11,6 +11,8 @@
 namespace aztec3::circuits::abis {
 
 using aztec3::utils::types::CircuitTypes;
+using aztec3::utils::types::msgpack_fields;
+using aztec3::utils::types::msgpack_packed;
 using aztec3::utils::types::NativeTypes;
 using std::is_same;
 
@@ -31,7 +33,20 @@ template <typename NCT> struct PreviousKernelData {
     std::array<fr, VK_TREE_HEIGHT> vk_path = zero_array<fr, VK_TREE_HEIGHT>();
 
     // for serialization, update with new fields
-    MSGPACK_FIELDS(public_inputs, proof, vk, vk_index, vk_path);
+    void msgpack(auto pack_fn)
+    {
+        msgpack_fields(pack_fn,
+                       "public_inputs",
+                       public_inputs,
+                       "proof",
+                       proof,
+                       "vk",
+                       vk,
+                       "vk_index",
+                       vk_index,
+                       "vk_path",
+                       msgpack_packed(vk_path));
+    }
     boolean operator==(PreviousKernelData<NCT> const& other) const
     {
         // WARNING: proof not checked!
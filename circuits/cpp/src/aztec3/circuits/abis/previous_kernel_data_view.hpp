@@ -0,0 +1,104 @@
+#pragma once
+#include "kernel_circuit_public_inputs.hpp"
+#include "previous_kernel_data.hpp"
+
+#include "aztec3/constants.hpp"
+#include <aztec3/utils/array.hpp>
+#include <aztec3/utils/types/native_types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace aztec3::circuits::abis {
+
+using aztec3::utils::zero_array;
+using aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief A read-only view of a serialized `PreviousKernelData<NativeTypes>`, for the native circuits
+ *
+ * @details The native circuits read the public inputs and the vk index and path of a previous kernel, but not its proof
+ * or its verification key. Reading a view deserializes the former only: `proof` and `vk_buf` point into the input
+ * buffer, which must outlive the view, and the verification key (with its reference string) is only parsed and built
+ * by `vk()`. Reading skips the key using the lengths it encodes (see `skip_vk_data`). The public inputs are read
+ * eagerly, as the native circuits read most of them: reading them allocates the vectors of their aggregation object
+ * (its public inputs and proof witness indices), and nothing else.
+ */
+struct PreviousKernelDataView {
+    using fr = NativeTypes::fr;
+    using uint32 = NativeTypes::uint32;
+    using VK = NativeTypes::VK;
+
+    KernelCircuitPublicInputs<NativeTypes> public_inputs{};
+    // the `proof_data` of the proof
+    std::span<uint8_t const> proof;
+    // the serialized verification key
+    std::span<uint8_t const> vk_buf;
+    uint32 vk_index = 0;
+    std::array<fr, VK_TREE_HEIGHT> vk_path = zero_array<fr, VK_TREE_HEIGHT>();
+
+    std::shared_ptr<VK> vk() const
+    {
+        uint8_t const* it = vk_buf.data();
+        auto key = std::make_shared<VK>();
+        read(it, *key);
+        return key;
+    }
+};
+
+/**
+ * @brief Advance `it` past a serialized `NativeTypes::VKData`, from the lengths it encodes rather than by reading it
+ *
+ * @details Follows the layout `read(it, verification_key_data&)` reads: the composer type, circuit size and number of
+ * public inputs (a uint32 each), the commitments (a map of names to affine points, its size first, then each name's
+ * length and bytes, and its point), whether the key contains a recursive proof (a bool) and the indices of that proof's
+ * public inputs (a vector of uint32, its size first).
+ */
+inline void skip_vk_data(uint8_t const*& it)
+{
+    using serialize::read;
+
+    constexpr size_t header_size = 3 * sizeof(uint32_t);
+    // the x and y coordinates of an affine point
+    constexpr size_t point_size = 2 * 32;
+
+    it += header_size;
+    uint32_t num_commitments = 0;
+    read(it, num_commitments);
+    for (uint32_t i = 0; i < num_commitments; i++) {
+        uint32_t name_size = 0;
+        read(it, name_size);
+        it += name_size + point_size;
+    }
+    // contains_recursive_proof
+    it += 1;
+    uint32_t num_recursive_proof_public_input_indices = 0;
+    read(it, num_recursive_proof_public_input_indices);
+    it += num_recursive_proof_public_input_indices * sizeof(uint32_t);
+}
+
+inline void read(uint8_t const*& it, PreviousKernelDataView& kernel_data)
+{
+    using serialize::read;
+
+    read(it, kernel_data.public_inputs);
+
+    // as `NativeTypes::Proof`, its `proof_data` length first
+    uint32_t proof_size = 0;
+    read(it, proof_size);
+    kernel_data.proof = { it, proof_size };
+    it += proof_size;
+
+    // the key is only parsed by `vk()`
+    uint8_t const* const vk_begin = it;
+    skip_vk_data(it);
+    kernel_data.vk_buf = { vk_begin, it };
+
+    read(it, kernel_data.vk_index);
+    read(it, kernel_data.vk_path);
+};
+
+}  // namespace aztec3::circuits::abis
@@ -18,6 +18,8 @@ namespace aztec3::circuits::abis {
 
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
+using aztec3::utils::types::msgpack_fields;
+using aztec3::utils::types::msgpack_packed;
 using aztec3::utils::types::NativeTypes;
 
 template <typename NCT> struct PublicCircuitPublicInputs {
@@ -44,16 +46,30 @@ template <typename NCT> struct PublicCircuitPublicInputs {
     address prover_address;
 
     // for serialization, update with new fields
-    MSGPACK_FIELDS(call_context,
-                   args,
-                   return_values,
-                   emitted_events,
-                   contract_storage_update_requests,
-                   contract_storage_reads,
-                   public_call_stack,
-                   new_l2_to_l1_msgs,
-                   historic_public_data_tree_root,
-                   prover_address);
+    void msgpack(auto pack_fn)
+    {
+        msgpack_fields(pack_fn,
+                       "call_context",
+                       call_context,
+                       "args",
+                       msgpack_packed(args),
+                       "return_values",
+                       msgpack_packed(return_values),
+                       "emitted_events",
+                       msgpack_packed(emitted_events),
+                       "contract_storage_update_requests",
+                       contract_storage_update_requests,
+                       "contract_storage_reads",
+                       contract_storage_reads,
+                       "public_call_stack",
+                       msgpack_packed(public_call_stack),
+                       "new_l2_to_l1_msgs",
+                       msgpack_packed(new_l2_to_l1_msgs),
+                       "historic_public_data_tree_root",
+                       historic_public_data_tree_root,
+                       "prover_address",
+                       prover_address);
+    }
     boolean operator==(PublicCircuitPublicInputs<NCT> const& other) const
     {
         return msgpack_derived_equals<boolean>(*this, other);
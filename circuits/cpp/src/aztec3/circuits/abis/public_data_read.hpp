@@ -1,5 +1,6 @@
 #pragma once
 #include "aztec3/constants.hpp"
+#include <aztec3/utils/serialized_size.hpp>
 #include <aztec3/utils/types/circuit_types.hpp>
 #include <aztec3/utils/types/convert.hpp>
 #include <aztec3/utils/types/native_types.hpp>
@@ -54,7 +55,7 @@ template <typename NCT> struct PublicDataRead {
 
     fr hash() const
     {
-        std::vector<fr> inputs = {
+        std::array<fr, 2> const inputs = {
             leaf_index,
             value,
         };
@@ -81,12 +82,17 @@ template <typename NCT> void read(uint8_t const*& it, PublicDataRead<NCT>& publi
     read(it, publicDataRead.value);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, PublicDataRead<NCT> const& publicDataRead)
+template <typename NCT> void write(uint8_t*& it, PublicDataRead<NCT> const& publicDataRead)
 {
     using serialize::write;
 
-    write(buf, publicDataRead.leaf_index);
-    write(buf, publicDataRead.value);
+    write(it, publicDataRead.leaf_index);
+    write(it, publicDataRead.value);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, PublicDataRead<NCT> const& publicDataRead)
+{
+    aztec3::utils::append_fixed(buf, publicDataRead);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, PublicDataRead<NCT> const& publicDataRead)
@@ -95,4 +101,11 @@ template <typename NCT> std::ostream& operator<<(std::ostream& os, PublicDataRea
               << "value: " << publicDataRead.value << "\n";
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::PublicDataRead<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::fr> {};
+
+}  // namespace aztec3::utils
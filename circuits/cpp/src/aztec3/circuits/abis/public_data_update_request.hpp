@@ -1,5 +1,6 @@
 #pragma once
 #include "aztec3/constants.hpp"
+#include <aztec3/utils/serialized_size.hpp>
 #include <aztec3/utils/types/circuit_types.hpp>
 #include <aztec3/utils/types/convert.hpp>
 #include <aztec3/utils/types/native_types.hpp>
@@ -59,7 +60,7 @@ template <typename NCT> struct PublicDataUpdateRequest {
 
     fr hash() const
     {
-        std::vector<fr> inputs = {
+        std::array<fr, 3> const inputs = {
             leaf_index,
             old_value,
             new_value,
@@ -89,13 +90,18 @@ template <typename NCT> void read(uint8_t const*& it, PublicDataUpdateRequest<NC
     read(it, update_request.new_value);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, PublicDataUpdateRequest<NCT> const& update_request)
+template <typename NCT> void write(uint8_t*& it, PublicDataUpdateRequest<NCT> const& update_request)
 {
     using serialize::write;
 
-    write(buf, update_request.leaf_index);
-    write(buf, update_request.old_value);
-    write(buf, update_request.new_value);
+    write(it, update_request.leaf_index);
+    write(it, update_request.old_value);
+    write(it, update_request.new_value);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, PublicDataUpdateRequest<NCT> const& update_request)
+{
+    aztec3::utils::append_fixed(buf, update_request);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, PublicDataUpdateRequest<NCT> const& update_request)
@@ -106,3 +112,10 @@ template <typename NCT> std::ostream& operator<<(std::ostream& os, PublicDataUpd
 }
 
 }  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::PublicDataUpdateRequest<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::fr, types::NativeTypes::fr> {};
+
+}  // namespace aztec3::utils
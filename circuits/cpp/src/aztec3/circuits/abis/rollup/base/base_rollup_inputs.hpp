@@ -2,6 +2,7 @@
 #include "../../append_only_tree_snapshot.hpp"
 #include "../../membership_witness.hpp"
 #include "../../previous_kernel_data.hpp"
+#include "../../previous_kernel_data_view.hpp"
 #include "../constant_rollup_data.hpp"
 #include "../nullifier_leaf_preimage.hpp"
 
@@ -18,35 +19,98 @@ using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
 using std::is_same;
 
-template <typename NCT> struct BaseRollupInputs {
+/**
+ * @brief The depth of the smallest subtree that holds `num_leaves` leaves
+ */
+constexpr size_t subtree_depth(size_t num_leaves)
+{
+    return num_leaves <= 1 ? 0 : 1 + subtree_depth((num_leaves + 1) / 2);
+}
+
+/**
+ * @brief The sizes of the subtrees and witnesses of a base rollup which folds `NUM_KERNELS` kernels
+ *
+ * @details Each subtree inserted by a base rollup holds the new leaves of all of its kernels, so its depth grows by
+ * one every time the number of kernels doubles (and the sibling path to insert it shrinks by one).
+ *
+ * @tparam NUM_KERNELS The number of kernels, a power of 2 of at least 2
+ */
+template <size_t NUM_KERNELS> struct BaseRollupSizes {
+    static_assert(NUM_KERNELS >= 2 && (NUM_KERNELS & (NUM_KERNELS - 1)) == 0,
+                  "The number of kernels per base rollup must be a power of 2");
+
+    static constexpr size_t NEW_COMMITMENTS_LENGTH = NUM_KERNELS * KERNEL_NEW_COMMITMENTS_LENGTH;
+    static constexpr size_t NEW_NULLIFIERS_LENGTH = NUM_KERNELS * KERNEL_NEW_NULLIFIERS_LENGTH;
+    static constexpr size_t NEW_CONTRACTS_LENGTH = NUM_KERNELS * KERNEL_NEW_CONTRACTS_LENGTH;
+    static constexpr size_t PUBLIC_DATA_UPDATE_REQUESTS_LENGTH =
+        NUM_KERNELS * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH;
+    static constexpr size_t PUBLIC_DATA_READS_LENGTH = NUM_KERNELS * KERNEL_PUBLIC_DATA_READS_LENGTH;
+
+    static constexpr size_t PRIVATE_DATA_SUBTREE_DEPTH = subtree_depth(NEW_COMMITMENTS_LENGTH);
+    static constexpr size_t NULLIFIER_SUBTREE_DEPTH = subtree_depth(NEW_NULLIFIERS_LENGTH);
+    static constexpr size_t CONTRACT_SUBTREE_DEPTH = subtree_depth(NEW_CONTRACTS_LENGTH);
+
+    // The height of the rollup subtree a base rollup stands for, so that merge and root rollups only combine base
+    // rollups of the same size: a base rollup of 2 kernels is a leaf (height 0), one of 4 kernels folds as many
+    // transactions as a merge of two of those (height 1), and so on
+    static constexpr size_t ROLLUP_SUBTREE_HEIGHT = subtree_depth(NUM_KERNELS) - 1;
+
+    static constexpr size_t PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH =
+        PRIVATE_DATA_TREE_HEIGHT - PRIVATE_DATA_SUBTREE_DEPTH;
+    static constexpr size_t NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH = NULLIFIER_TREE_HEIGHT - NULLIFIER_SUBTREE_DEPTH;
+    static constexpr size_t CONTRACT_SUBTREE_INCLUSION_CHECK_DEPTH = CONTRACT_TREE_HEIGHT - CONTRACT_SUBTREE_DEPTH;
+
+    // subtree insertions need a full subtree of leaves
+    static_assert((1UL << PRIVATE_DATA_SUBTREE_DEPTH) == NEW_COMMITMENTS_LENGTH);
+    static_assert((1UL << NULLIFIER_SUBTREE_DEPTH) == NEW_NULLIFIERS_LENGTH);
+    static_assert((1UL << CONTRACT_SUBTREE_DEPTH) == NEW_CONTRACTS_LENGTH);
+    static_assert(PRIVATE_DATA_SUBTREE_DEPTH <= PRIVATE_DATA_TREE_HEIGHT);
+    static_assert(NULLIFIER_SUBTREE_DEPTH <= NULLIFIER_TREE_HEIGHT);
+    static_assert(CONTRACT_SUBTREE_DEPTH <= CONTRACT_TREE_HEIGHT);
+};
+
+// The default base rollup must match the global constants (which the TS types mirror)
+static_assert(BaseRollupSizes<KERNELS_PER_BASE_ROLLUP>::PRIVATE_DATA_SUBTREE_DEPTH == PRIVATE_DATA_SUBTREE_DEPTH);
+static_assert(BaseRollupSizes<KERNELS_PER_BASE_ROLLUP>::NULLIFIER_SUBTREE_DEPTH == NULLIFIER_SUBTREE_DEPTH);
+static_assert(BaseRollupSizes<KERNELS_PER_BASE_ROLLUP>::CONTRACT_SUBTREE_DEPTH == CONTRACT_SUBTREE_DEPTH);
+
+/**
+ * @tparam KernelData `PreviousKernelData<NCT>`, or `PreviousKernelDataView` to read the kernels of serialized native
+ * inputs without copying their proofs or building their verification keys (see `BaseRollupInputsView`)
+ */
+template <typename NCT,
+          size_t NUM_KERNELS = KERNELS_PER_BASE_ROLLUP,
+          typename KernelData = PreviousKernelData<NCT>>
+struct BaseRollupInputs {
     using fr = typename NCT::fr;
+    using Sizes = BaseRollupSizes<NUM_KERNELS>;
 
-    std::array<PreviousKernelData<NCT>, 2> kernel_data;
+    std::array<KernelData, NUM_KERNELS> kernel_data;
 
     AppendOnlyTreeSnapshot<NCT> start_private_data_tree_snapshot;
     AppendOnlyTreeSnapshot<NCT> start_nullifier_tree_snapshot;
     AppendOnlyTreeSnapshot<NCT> start_contract_tree_snapshot;
     fr start_public_data_tree_root;
 
-    std::array<NullifierLeafPreimage<NCT>, 2 * KERNEL_NEW_NULLIFIERS_LENGTH> low_nullifier_leaf_preimages;
-    std::array<MembershipWitness<NCT, NULLIFIER_TREE_HEIGHT>, 2 * KERNEL_NEW_NULLIFIERS_LENGTH>
+    std::array<NullifierLeafPreimage<NCT>, Sizes::NEW_NULLIFIERS_LENGTH> low_nullifier_leaf_preimages;
+    std::array<MembershipWitness<NCT, NULLIFIER_TREE_HEIGHT>, Sizes::NEW_NULLIFIERS_LENGTH>
         low_nullifier_membership_witness;
 
     // For inserting the new subtrees into their respective trees:
     // Note: the insertion leaf index can be derived from the above snapshots' `next_available_leaf_index` values.
-    std::array<fr, PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH> new_commitments_subtree_sibling_path;
-    std::array<fr, NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH> new_nullifiers_subtree_sibling_path;
-    std::array<fr, CONTRACT_SUBTREE_INCLUSION_CHECK_DEPTH> new_contracts_subtree_sibling_path;
-    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, 2 * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH>
+    std::array<fr, Sizes::PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH> new_commitments_subtree_sibling_path;
+    std::array<fr, Sizes::NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH> new_nullifiers_subtree_sibling_path;
+    std::array<fr, Sizes::CONTRACT_SUBTREE_INCLUSION_CHECK_DEPTH> new_contracts_subtree_sibling_path;
+    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, Sizes::PUBLIC_DATA_UPDATE_REQUESTS_LENGTH>
         new_public_data_update_requests_sibling_paths;
-    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, 2 * KERNEL_PUBLIC_DATA_READS_LENGTH>
+    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, Sizes::PUBLIC_DATA_READS_LENGTH>
         new_public_data_reads_sibling_paths;
 
-    std::array<MembershipWitness<NCT, PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT>, 2>
+    std::array<MembershipWitness<NCT, PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT>, NUM_KERNELS>
         historic_private_data_tree_root_membership_witnesses;
-    std::array<MembershipWitness<NCT, CONTRACT_TREE_ROOTS_TREE_HEIGHT>, 2>
+    std::array<MembershipWitness<NCT, CONTRACT_TREE_ROOTS_TREE_HEIGHT>, NUM_KERNELS>
         historic_contract_tree_root_membership_witnesses;
-    std::array<MembershipWitness<NCT, L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT>, 2>
+    std::array<MembershipWitness<NCT, L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT>, NUM_KERNELS>
         historic_l1_to_l2_msg_tree_root_membership_witnesses;
 
     ConstantRollupData<NCT> constants;
@@ -68,10 +132,18 @@ template <typename NCT> struct BaseRollupInputs {
                    historic_contract_tree_root_membership_witnesses,
                    historic_l1_to_l2_msg_tree_root_membership_witnesses,
                    constants);
-    bool operator==(BaseRollupInputs<NCT> const&) const = default;
+    bool operator==(BaseRollupInputs const&) const = default;
 };
 
-template <typename NCT> void read(uint8_t const*& it, BaseRollupInputs<NCT>& obj)
+/**
+ * @brief Native base rollup inputs read for simulation: their kernels are views into the serialized inputs, which must
+ * outlive them
+ */
+template <size_t NUM_KERNELS = KERNELS_PER_BASE_ROLLUP>
+using BaseRollupInputsView = BaseRollupInputs<NativeTypes, NUM_KERNELS, PreviousKernelDataView>;
+
+template <typename NCT, size_t NUM_KERNELS, typename KernelData>
+void read(uint8_t const*& it, BaseRollupInputs<NCT, NUM_KERNELS, KernelData>& obj)
 {
     using serialize::read;
 
@@ -93,7 +165,8 @@ template <typename NCT> void read(uint8_t const*& it, BaseRollupInputs<NCT>& obj
     read(it, obj.constants);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, BaseRollupInputs<NCT> const& obj)
+template <typename NCT, size_t NUM_KERNELS>
+void write(std::vector<uint8_t>& buf, BaseRollupInputs<NCT, NUM_KERNELS> const& obj)
 {
     using serialize::write;
 
@@ -115,7 +188,8 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, BaseRollupInputs<N
     write(buf, obj.constants);
 };
 
-template <typename NCT> std::ostream& operator<<(std::ostream& os, BaseRollupInputs<NCT> const& obj)
+template <typename NCT, size_t NUM_KERNELS>
+std::ostream& operator<<(std::ostream& os, BaseRollupInputs<NCT, NUM_KERNELS> const& obj)
 {
     return os << "kernel_data:\n"
               << obj.kernel_data << "\n"
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "aztec3/utils/serialized_size.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 
 #include "barretenberg/serialize/msgpack.hpp"
@@ -34,13 +35,18 @@ template <typename NCT> void read(uint8_t const*& it, NullifierLeafPreimage<NCT>
     read(it, obj.next_index);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, NullifierLeafPreimage<NCT> const& obj)
+template <typename NCT> void write(uint8_t*& it, NullifierLeafPreimage<NCT> const& obj)
 {
     using serialize::write;
 
-    write(buf, obj.leaf_value);
-    write(buf, obj.next_value);
-    write(buf, obj.next_index);
+    write(it, obj.leaf_value);
+    write(it, obj.next_value);
+    write(it, obj.next_index);
+};
+
+template <typename NCT> void write(std::vector<uint8_t>& buf, NullifierLeafPreimage<NCT> const& obj)
+{
+    aztec3::utils::append_fixed(buf, obj);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, NullifierLeafPreimage<NCT> const& obj)
@@ -50,4 +56,11 @@ template <typename NCT> std::ostream& operator<<(std::ostream& os, NullifierLeaf
               << "next_index: " << obj.next_index << "\n";
 }
 
-}  // namespace aztec3::circuits::abis
\ No newline at end of file
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <> struct SerializedSize<circuits::abis::NullifierLeafPreimage<types::NativeTypes>>
+    : SerializedSizeOf<types::NativeTypes::fr, types::NativeTypes::fr, types::NativeTypes::uint32> {};
+
+}  // namespace aztec3::utils
@@ -64,7 +64,7 @@ template <typename NCT> struct SignedTxRequest {
         fr const sfr = fr::serialize_from_buffer(signature.s.cbegin());
         fr const rfr = fr::serialize_from_buffer(signature.r.cbegin());
         fr const vfr = signature.v;
-        std::vector<fr> const inputs = { tx_request.hash(), rfr, sfr, vfr };
+        std::array<fr, 4> const inputs = { tx_request.hash(), rfr, sfr, vfr };
         return NCT::compress(inputs, GeneratorIndex::SIGNED_TX_REQUEST);
     }
 };
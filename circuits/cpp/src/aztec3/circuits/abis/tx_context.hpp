@@ -81,7 +81,7 @@ template <typename NCT> struct TxContext {
 
     fr hash() const
     {
-        std::vector<fr> const inputs = {
+        std::array<fr, 4> const inputs = {
             fr(is_fee_payment_tx),
             fr(is_rebate_payment_tx),
             fr(is_contract_deployment_tx),
@@ -10,11 +10,16 @@
 #include <aztec3/circuits/abis/private_circuit_public_inputs.hpp>
 #include <aztec3/circuits/abis/types.hpp>
 #include <aztec3/constants.hpp>
+#include <aztec3/utils/shared_reference_string_factory.hpp>
 #include <aztec3/utils/types/convert.hpp>
 
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/srs/reference_string/file_reference_string.hpp>
 #include <barretenberg/stdlib/primitives/field/array.hpp>
 
+#include <exception>
+#include <vector>
+
 namespace aztec3::circuits::apps {
 
 using aztec3::circuits::abis::CallStackItem;
@@ -28,6 +33,7 @@ using aztec3::circuits::apps::opcodes::Opcodes;
 
 using plonk::stdlib::array_push;
 
+using aztec3::utils::SharedReferenceStringFactory;
 using aztec3::utils::types::CircuitTypes;
 using plonk::stdlib::witness_t;
 using NT = aztec3::utils::types::NativeTypes;
@@ -48,6 +54,10 @@ template <typename Composer> class FunctionExecutionContext {
     Composer& composer;
     OracleWrapperInterface<Composer>& oracle;
 
+    // Given to the composers of nested calls, and shared with their exec_ctxs, so that the reference string is only
+    // loaded once however many nested calls are made.
+    std::shared_ptr<proof_system::ReferenceStringFactory> crs_factory;
+
     Contract<NT>* contract = nullptr;
 
     std::array<std::shared_ptr<FunctionExecutionContext<Composer>>, PRIVATE_CALL_STACK_LENGTH>
@@ -69,9 +79,19 @@ template <typename Composer> class FunctionExecutionContext {
     bool is_finalised = false;
 
   public:
-    FunctionExecutionContext<Composer>(Composer& composer, OracleWrapperInterface<Composer>& oracle)
+    /**
+     * @param crs_factory The factory for the composers of nested calls. A top-level exec_ctx may omit it: it then gets
+     * a new one, loading the reference string from the default path.
+     */
+    FunctionExecutionContext<Composer>(Composer& composer,
+                                       OracleWrapperInterface<Composer>& oracle,
+                                       std::shared_ptr<proof_system::ReferenceStringFactory> crs_factory = nullptr)
         : composer(composer)
         , oracle(oracle)
+        , crs_factory(crs_factory ? std::move(crs_factory)
+                                  : std::make_shared<SharedReferenceStringFactory>(
+                                        std::make_shared<proof_system::FileReferenceStringFactory>(
+                                            "../barretenberg/cpp/srs_db/ignition")))
         , private_circuit_public_inputs(OptionalPrivateCircuitPublicInputs<CT>::create())
     {
         private_circuit_public_inputs.call_context = oracle.get_call_context();
@@ -151,6 +171,9 @@ template <typename Composer> class FunctionExecutionContext {
     /**
      * @brief Allows a call to be made to a function of another contract
      *
+     * @details Any calls deferred with `defer_call` are executed first, so that the private call stack is in the order
+     * the calls were made.
+     *
      * TODO: maybe we want to move some of the code that's in this function into a method in the Opcodes class. Although
      * that class was really shoehorned into existence, and is a bit bleurgh.
      */
@@ -159,6 +182,141 @@ template <typename Composer> class FunctionExecutionContext {
         std::string const& f_name,
         std::function<void(FunctionExecutionContext<Composer>&, std::array<NT::fr, ARGS_LENGTH>)> f,
         std::array<fr, ARGS_LENGTH> const& args)
+    {
+        execute_deferred_calls();
+
+        auto& nested_call = prepare_nested_call(f_contract_address, f_name, std::move(f), args);
+        nested_call.execute();
+        finalise_nested_call(nested_call);
+        return nested_call.return_values;
+    }
+
+    /**
+     * @brief Same as `call`, but the call is only executed by `execute_deferred_calls()`, together with any other calls
+     * deferred since the last execution
+     *
+     * @details A nested call only meets `this` exec_ctx through its public inputs, so deferred calls are built (each
+     * with its own composer and oracle) in parallel. Their public inputs are then constrained in `this` circuit and
+     * pushed to its private call stack in the order the calls were deferred, so the result does not depend on which
+     * call finished first. The function `f` must therefore not touch `this` exec_ctx.
+     *
+     * @return size_t The handle of the call, to get its return values with `get_deferred_call_return_values`
+     */
+    size_t defer_call(address const& f_contract_address,
+                      std::string const& f_name,
+                      std::function<void(FunctionExecutionContext<Composer>&, std::array<NT::fr, ARGS_LENGTH>)> f,
+                      std::array<fr, ARGS_LENGTH> const& args)
+    {
+        prepare_nested_call(f_contract_address, f_name, std::move(f), args);
+        return nested_calls.size() - 1;
+    }
+
+    /**
+     * @brief Execute the calls deferred with `defer_call` (in parallel unless NO_MULTITHREADING), then apply `this`
+     * circuit's constraints on their public inputs, in the order they were deferred
+     */
+    void execute_deferred_calls()
+    {
+        auto const num_calls = nested_calls.size();
+#ifdef __cpp_exceptions
+        // an exception can't leave an OpenMP region (it would terminate the process), so the exception of each call is
+        // kept, and the one of the first call deferred is rethrown once they all finished
+        std::vector<std::exception_ptr> exceptions(num_calls);
+#endif
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+        for (size_t i = num_finalised_nested_calls; i < num_calls; ++i) {
+#ifdef __cpp_exceptions
+            try {
+                nested_calls[i]->execute();
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+#else
+            nested_calls[i]->execute();
+#endif
+        }
+#ifdef __cpp_exceptions
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+#endif
+        for (size_t i = num_finalised_nested_calls; i < num_calls; ++i) {
+            finalise_nested_call(*nested_calls[i]);
+        }
+    }
+
+    /**
+     * @brief The return values of a call deferred with `defer_call`, once `execute_deferred_calls()` executed it
+     */
+    std::array<fr, RETURN_VALUES_LENGTH> const& get_deferred_call_return_values(size_t call_handle)
+    {
+        if (call_handle >= num_finalised_nested_calls) {
+            throw_or_abort("This deferred call has not been executed: call exec_ctx.execute_deferred_calls() first.");
+        }
+        return nested_calls[call_handle]->return_values;
+    }
+
+  private:
+    using NestedFunction = std::function<void(FunctionExecutionContext<Composer>&, std::array<NT::fr, ARGS_LENGTH>)>;
+
+    /**
+     * @brief A call made by `this` exec_ctx's function, and everything its exec_ctx refers to, kept alive for as long
+     * as `this` exec_ctx (which keeps the nested exec_ctx in `nested_private_call_exec_ctxs`)
+     */
+    struct NestedCall {
+        address contract_address;
+        FunctionData<CT> function_data;
+        std::array<fr, ARGS_LENGTH> args;
+        std::array<NT::fr, ARGS_LENGTH> native_args;
+        NestedFunction f;
+
+        Composer composer;
+        NativeOracle oracle;
+        OracleWrapperInterface<Composer> oracle_wrapper;
+        std::shared_ptr<FunctionExecutionContext<Composer>> exec_ctx;
+
+        // the return values, constrained in `this` circuit, once the call is finalised
+        std::array<fr, RETURN_VALUES_LENGTH> return_values{};
+
+        NestedCall(address const& contract_address,
+                   FunctionData<CT> const& function_data,
+                   std::array<fr, ARGS_LENGTH> const& args,
+                   NestedFunction f,
+                   NativeOracle const& oracle,
+                   std::shared_ptr<proof_system::ReferenceStringFactory> const& crs_factory)
+            : contract_address(contract_address)
+            , function_data(function_data)
+            , args(args)
+            , native_args(to_nt<Composer>(args))
+            , f(std::move(f))
+            , composer(crs_factory)
+            , oracle(oracle)
+            , oracle_wrapper(composer, this->oracle)
+            , exec_ctx(std::make_shared<FunctionExecutionContext<Composer>>(composer, oracle_wrapper, crs_factory))
+        {}
+
+        /**
+         * @brief Build the nested call's circuit. It only touches the nested call's own composer and oracle.
+         */
+        void execute()
+        {
+            // This calls the function `f`, passing the arguments shown.
+            // The exec_ctx will be populated with all the information about that function's execution.
+            std::apply(f, std::forward_as_tuple(*exec_ctx, native_args));
+        }
+    };
+
+    /**
+     * @brief Everything about a call that is done in `this` circuit before the nested call is executed
+     */
+    NestedCall& prepare_nested_call(address const& f_contract_address,
+                                    std::string const& f_name,
+                                    NestedFunction f,
+                                    std::array<fr, ARGS_LENGTH> const& args)
     {
         // Convert function name to bytes and use the first 4 bytes as the function encoding, for now:
         std::vector<uint8_t> f_name_bytes(f_name.begin(), f_name.end());
@@ -201,26 +359,26 @@ template <typename Composer> class FunctionExecutionContext {
                                                 // contract (which cannot own a secret), rather than a human.
         );
 
-        Composer f_composer = Composer("../barretenberg/cpp/srs_db/ignition");
-
-        OracleWrapperInterface<Composer> f_oracle_wrapper(f_composer, f_oracle);
+        nested_calls.push_back(std::make_unique<NestedCall>(
+            f_contract_address, f_function_data_ct, args, std::move(f), f_oracle, crs_factory));
+        auto& nested_call = *nested_calls.back();
 
-        // We need an exec_ctx reference which won't go out of scope, so we store a shared_ptr to the newly-created
-        // exec_ctx in `this` exec_ctx.
-        auto f_exec_ctx = std::make_shared<FunctionExecutionContext<Composer>>(f_composer, f_oracle_wrapper);
+        // The nested exec_ctx is kept in the order of the calls, whatever the order they are executed in.
+        array_push(nested_private_call_exec_ctxs, nested_call.exec_ctx);
 
-        array_push(nested_private_call_exec_ctxs, f_exec_ctx);
-
-        auto native_args = to_nt<Composer>(args);
-
-        // This calls the function `f`, passing the arguments shown.
-        // The f_exec_ctx will be populated with all the information about that function's execution.
-        std::apply(f, std::forward_as_tuple(*f_exec_ctx, native_args));
+        return nested_call;
+    }
 
-        // Remember: the data held in the f_exec_ctc was built with a different composer than that
+    /**
+     * @brief Constrain the public inputs of an executed nested call in `this` circuit, and push it to the private call
+     * stack
+     */
+    void finalise_nested_call(NestedCall& nested_call)
+    {
+        // Remember: the data held in the nested exec_ctx was built with a different composer than that
         // of `this` exec_ctx. So we only allow ourselves to get the native types, so that we can consciously declare
         // circuit types for `this` exec_ctx using `this->composer`.
-        auto f_public_inputs_nt = f_exec_ctx->get_final_private_circuit_public_inputs();
+        auto f_public_inputs_nt = nested_call.exec_ctx->get_final_private_circuit_public_inputs();
 
         // Since we've made a call to another function, we now need to push a call_stack_item_hash to `this` function's
         // private call stack.
@@ -232,12 +390,12 @@ template <typename Composer> class FunctionExecutionContext {
 
         // Constrain that the arguments of the executed function match those we expect:
         for (size_t i = 0; i < f_public_inputs_ct.args.size(); ++i) {
-            args[i].assert_equal(f_public_inputs_ct.args[i]);
+            nested_call.args[i].assert_equal(f_public_inputs_ct.args[i]);
         }
 
         CallStackItem<CT, PrivateTypes> const f_call_stack_item_ct{
-            .contract_address = f_contract_address,
-            .function_data = f_function_data_ct,
+            .contract_address = nested_call.contract_address,
+            .function_data = nested_call.function_data,
             .public_inputs = f_public_inputs_ct,
         };
 
@@ -248,9 +406,16 @@ template <typename Composer> class FunctionExecutionContext {
         // The return values are implicitly constrained by being returned as circuit types from this method, for
         // further use in the circuit. Note: ALL elements of the return_values array MUST be constrained, even if
         // they're placeholder zeroes.
-        return f_public_inputs_ct.return_values;
+        nested_call.return_values = f_public_inputs_ct.return_values;
+        num_finalised_nested_calls++;
     }
 
+    // The nested calls made so far. Those from `num_finalised_nested_calls` on were deferred and are not executed yet.
+    std::vector<std::unique_ptr<NestedCall>> nested_calls;
+    size_t num_finalised_nested_calls = 0;
+
+  public:
+
     /**
      * @brief This is an important optimisation, to save on the number of emitted nullifiers.
      *
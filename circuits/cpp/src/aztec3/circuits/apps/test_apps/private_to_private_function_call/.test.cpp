@@ -11,7 +11,60 @@
 
 namespace aztec3::circuits::apps::test_apps::private_to_private_function_call {
 
-class private_to_private_function_call_tests : public ::testing::Test {};
+class private_to_private_function_call_tests : public ::testing::Test {
+  protected:
+    /**
+     * @brief Make two nested calls to function_2_1, either one after the other or deferred (and executed together)
+     *
+     * @return The private call stack of the calling function and the first return value of each call
+     */
+    static std::pair<std::array<NT::fr, PRIVATE_CALL_STACK_LENGTH>, std::array<NT::fr, 2>> make_two_calls(bool defer)
+    {
+        C composer = C("../barretenberg/cpp/srs_db/ignition");
+        DB db;
+
+        const NT::address contract_address = 12345;
+        const FunctionData<NT> function_data{
+            .function_selector = 1,
+            .is_private = true,
+            .is_constructor = false,
+        };
+        const CallContext<NT> call_context{
+            .msg_sender = 999999,
+            .storage_contract_address = contract_address,
+            .portal_contract_address = 0,
+            .is_delegate_call = false,
+            .is_static_call = false,
+            .is_contract_deployment = false,
+        };
+        NativeOracle oracle = NativeOracle(db, contract_address, function_data, call_context, 123456789);
+        OracleWrapper oracle_wrapper = OracleWrapper(composer, oracle);
+        FunctionExecutionContext exec_ctx(composer, oracle_wrapper);
+
+        auto const f = std::function<void(FunctionExecutionContext&, std::array<NT::fr, ARGS_LENGTH>)>(function_2_1);
+        std::array<CT::fr, ARGS_LENGTH> first_args{};
+        std::array<CT::fr, ARGS_LENGTH> second_args{};
+        for (size_t i = 0; i < 3; i++) {
+            first_args[i] = to_ct(composer, NT::fr(i + 1));
+            second_args[i] = to_ct(composer, NT::fr(i + 4));
+        }
+
+        std::array<NT::fr, 2> return_values;
+        if (defer) {
+            auto const first = exec_ctx.defer_call(23456, "function_2_1", f, first_args);
+            auto const second = exec_ctx.defer_call(34567, "function_2_1", f, second_args);
+            exec_ctx.execute_deferred_calls();
+            return_values = { exec_ctx.get_deferred_call_return_values(first)[0].get_value(),
+                              exec_ctx.get_deferred_call_return_values(second)[0].get_value() };
+        } else {
+            return_values = { exec_ctx.call(23456, "function_2_1", f, first_args)[0].get_value(),
+                              exec_ctx.call(34567, "function_2_1", f, second_args)[0].get_value() };
+        }
+
+        exec_ctx.finalise();
+        return { exec_ctx.get_final_private_circuit_public_inputs().private_call_stack, return_values };
+    }
+};
 
 TEST(private_to_private_function_call_tests, circuit_private_to_private_function_call)
 {
@@ -60,6 +113,61 @@ TEST(private_to_private_function_call_tests, circuit_private_to_private_function
     info("failed?: ", fn1_composer.failed());
     info("err: ", fn1_composer.err());
     info("n: ", fn1_composer.num_gates);
+
+    // the nested call loads its reference string through the same (shared) factory
+    ASSERT_TRUE(fn1_exec_ctx.nested_private_call_exec_ctxs[0] != nullptr);
+    EXPECT_EQ(fn1_exec_ctx.nested_private_call_exec_ctxs[0]->crs_factory, fn1_exec_ctx.crs_factory);
+}
+
+TEST_F(private_to_private_function_call_tests, circuit_deferred_calls_match_sequential_calls)
+{
+    auto const [sequential_call_stack, sequential_return_values] = make_two_calls(false);
+    auto const [deferred_call_stack, deferred_return_values] = make_two_calls(true);
+
+    EXPECT_EQ(deferred_call_stack, sequential_call_stack);
+    EXPECT_EQ(deferred_return_values, sequential_return_values);
+    EXPECT_EQ(deferred_return_values[0], NT::fr(1 * 2 * 3));
+    EXPECT_EQ(deferred_return_values[1], NT::fr(4 * 5 * 6));
+    EXPECT_NE(deferred_call_stack[1], NT::fr(0));
+}
+
+#ifdef __cpp_exceptions
+TEST(private_to_private_function_call_tests, circuit_deferred_call_exception_is_rethrown)
+{
+    C composer = C("../barretenberg/cpp/srs_db/ignition");
+    DB db;
+
+    const NT::address contract_address = 12345;
+    const FunctionData<NT> function_data{
+        .function_selector = 1,
+        .is_private = true,
+        .is_constructor = false,
+    };
+    const CallContext<NT> call_context{
+        .msg_sender = 999999,
+        .storage_contract_address = contract_address,
+        .portal_contract_address = 0,
+        .is_delegate_call = false,
+        .is_static_call = false,
+        .is_contract_deployment = false,
+    };
+    NativeOracle oracle = NativeOracle(db, contract_address, function_data, call_context, 123456789);
+    OracleWrapper oracle_wrapper = OracleWrapper(composer, oracle);
+    FunctionExecutionContext exec_ctx(composer, oracle_wrapper);
+
+    auto const f = std::function<void(FunctionExecutionContext&, std::array<NT::fr, ARGS_LENGTH>)>(function_2_1);
+    auto const throwing_f = std::function<void(FunctionExecutionContext&, std::array<NT::fr, ARGS_LENGTH>)>(
+        [](FunctionExecutionContext&, std::array<NT::fr, ARGS_LENGTH>) { throw_or_abort("deferred call failed"); });
+    std::array<CT::fr, ARGS_LENGTH> args{};
+    for (size_t i = 0; i < 3; i++) {
+        args[i] = to_ct(composer, NT::fr(i + 1));
+    }
+
+    // the exception of the throwing call leaves the parallel region and reaches the caller
+    exec_ctx.defer_call(23456, "function_2_1", f, args);
+    exec_ctx.defer_call(34567, "throwing_function", throwing_f, args);
+    EXPECT_THROW(exec_ctx.execute_deferred_calls(), std::runtime_error);
 }
+#endif
 
-}  // namespace aztec3::circuits::apps::test_apps::private_to_private_function_call
\ No newline at end of file
+}  // namespace aztec3::circuits::apps::test_apps::private_to_private_function_call
@@ -5,10 +5,25 @@
 #include <aztec3/circuits/abis/new_contract_data.hpp>
 #include <aztec3/constants.hpp>
 #include <aztec3/utils/circuit_errors.hpp>
+#include <aztec3/utils/sharded_lru_cache.hpp>
+#include <aztec3/utils/types/native_types.hpp>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/crypto/sha256/sha256.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 
 namespace aztec3::circuits {
 
@@ -30,7 +45,7 @@ template <typename NCT> typename NCT::fr compute_constructor_hash(FunctionData<N
     fr const function_data_hash = function_data.hash();
     fr const args_hash = compute_args_hash<NCT>(args);
 
-    std::vector<fr> const inputs = {
+    std::array<fr, 3> const inputs = {
         function_data_hash,
         args_hash,
         constructor_vk_hash,
@@ -47,7 +62,7 @@ template <typename NCT> typename NCT::address compute_contract_address(typename
     using fr = typename NCT::fr;
     using address = typename NCT::address;
 
-    std::vector<fr> const inputs = {
+    std::array<fr, 4> const inputs = {
         deployer_address.to_field(),
         contract_address_salt,
         function_tree_root,
@@ -57,17 +72,156 @@ template <typename NCT> typename NCT::address compute_contract_address(typename
     return address(NCT::compress(inputs, aztec3::GeneratorIndex::CONTRACT_ADDRESS));
 }
 
+/**
+ * @brief The inputs of a native compression of two field elements, the key of a `CompressionCache`
+ */
+struct CompressionKey {
+    size_t hash_index;
+    aztec3::utils::types::NativeTypes::fr left;
+    aztec3::utils::types::NativeTypes::fr right;
+
+    bool operator==(CompressionKey const&) const = default;
+};
+
+struct CompressionKeyHash {
+    size_t operator()(CompressionKey const& key) const
+    {
+        // the limbs of field elements in Montgomery form are well mixed, even for small values such as storage slots
+        return static_cast<size_t>(key.left.data[0] ^ std::rotl(key.right.data[0], 32) ^ key.hash_index);
+    }
+};
+
+using CompressionCache =
+    aztec3::utils::ShardedLruCache<CompressionKey, aztec3::utils::types::NativeTypes::fr, CompressionKeyHash>;
+
+constexpr size_t DEFAULT_COMPRESSION_CACHE_CAPACITY = 1 << 14;
+
+/**
+ * @brief The process-wide cache of public data tree leaf indices, see `compute_public_data_tree_index`
+ *
+ * @details Contracts read and update the same few storage slots in every block, each of which costs a compression.
+ */
+inline CompressionCache& get_public_data_tree_index_cache()
+{
+    static CompressionCache cache(DEFAULT_COMPRESSION_CACHE_CAPACITY);
+    return cache;
+}
+
+/**
+ * @brief The process-wide cache of siloed commitments and nullifiers, see `silo_commitment` and `silo_nullifier`
+ */
+inline CompressionCache& get_silo_cache()
+{
+    static CompressionCache cache(DEFAULT_COMPRESSION_CACHE_CAPACITY);
+    return cache;
+}
+
+/**
+ * @brief Same as `NativeTypes::compress({ left, right }, hash_index)`, computed only if `cache` doesn't hold it
+ */
+inline aztec3::utils::types::NativeTypes::fr cached_compress(CompressionCache& cache,
+                                                             aztec3::utils::types::NativeTypes::fr const& left,
+                                                             aztec3::utils::types::NativeTypes::fr const& right,
+                                                             size_t hash_index)
+{
+    using NT = aztec3::utils::types::NativeTypes;
+    return cache.get_or_compute({ .hash_index = hash_index, .left = left, .right = right },
+                                [&] { return NT::compress(std::array<NT::fr, 2>{ left, right }, hash_index); });
+}
+
+/**
+ * @brief How a verification key is hashed: as serialized verification key data (e.g. by `abis__hash_vk`), or by the
+ * recursive verifier (e.g. in the kernels)
+ */
+enum class VkHasher : uint8_t {
+    VK_DATA = 0,
+    RECURSIVE_VERIFIER = 1,
+};
+
+/**
+ * @brief A serialized verification key and how it is hashed, the key of a `VkHashCache`
+ */
+struct VkHashKey {
+    VkHasher hasher;
+    size_t hash_index;
+    std::vector<uint8_t> serialized_vk;
+
+    bool operator==(VkHashKey const&) const = default;
+};
+
+struct VkHashKeyHash {
+    size_t operator()(VkHashKey const& key) const
+    {
+        std::string_view const bytes(reinterpret_cast<char const*>(key.serialized_vk.data()), key.serialized_vk.size());
+        return std::hash<std::string_view>{}(bytes) ^ key.hash_index ^ static_cast<size_t>(key.hasher);
+    }
+};
+
+using VkHashCache = aztec3::utils::ShardedLruCache<VkHashKey, aztec3::utils::types::NativeTypes::fr, VkHashKeyHash, 4>;
+
+// a contract only has a few distinct function verification keys
+constexpr size_t DEFAULT_VK_HASH_CACHE_CAPACITY = 256;
+
+/**
+ * @brief The process-wide cache of verification key hashes, see `compute_vk_hash`
+ *
+ * @details Hashing a key compresses each of its commitments, and the same few keys are hashed for every call to their
+ * functions. Serializing a key to look its hash up is much cheaper than hashing it.
+ */
+inline VkHashCache& get_vk_hash_cache()
+{
+    static VkHashCache cache(DEFAULT_VK_HASH_CACHE_CAPACITY);
+    return cache;
+}
+
+/**
+ * @brief Same as `vk_data.compress_native(hash_index)`, computed only once for a given key
+ */
+inline aztec3::utils::types::NativeTypes::fr compute_vk_hash(aztec3::utils::types::NativeTypes::VKData const& vk_data,
+                                                             size_t hash_index = GeneratorIndex::VK)
+{
+    using serialize::write;
+
+    std::vector<uint8_t> serialized_vk;
+    write(serialized_vk, vk_data);
+    return get_vk_hash_cache().get_or_compute(
+        { .hasher = VkHasher::VK_DATA, .hash_index = hash_index, .serialized_vk = std::move(serialized_vk) },
+        [&] { return vk_data.compress_native(hash_index); });
+}
+
+/**
+ * @brief Same as `CT::VK::compress_native(vk, hash_index)`, the hash of a key by the recursive verifier of the
+ * circuits of `CT`, computed only once for a given key
+ */
+template <typename CT>
+aztec3::utils::types::NativeTypes::fr compute_vk_hash(std::shared_ptr<plonk::verification_key> const& vk,
+                                                      size_t hash_index = GeneratorIndex::VK)
+{
+    using serialize::write;
+
+    std::vector<uint8_t> serialized_vk;
+    write(serialized_vk, *vk);
+    return get_vk_hash_cache().get_or_compute(
+        { .hasher = VkHasher::RECURSIVE_VERIFIER, .hash_index = hash_index, .serialized_vk = std::move(serialized_vk) },
+        [&] { return CT::VK::compress_native(vk, hash_index); });
+}
+
 template <typename NCT>
 typename NCT::fr silo_commitment(typename NCT::address contract_address, typename NCT::fr commitment)
 {
     using fr = typename NCT::fr;
 
-    std::vector<fr> const inputs = {
-        contract_address.to_field(),
-        commitment,
-    };
+    if constexpr (std::is_same_v<NCT, aztec3::utils::types::NativeTypes>) {
+        return cached_compress(
+            get_silo_cache(), contract_address.to_field(), commitment, aztec3::GeneratorIndex::OUTER_COMMITMENT);
+    } else {
+        std::array<fr, 2> const inputs = {
+            contract_address.to_field(),
+            commitment,
+        };
 
-    return NCT::compress(inputs, aztec3::GeneratorIndex::OUTER_COMMITMENT);
+        return NCT::compress(inputs, aztec3::GeneratorIndex::OUTER_COMMITMENT);
+    }
 }
 
 template <typename NCT>
@@ -75,12 +229,17 @@ typename NCT::fr silo_nullifier(typename NCT::address contract_address, typename
 {
     using fr = typename NCT::fr;
 
-    std::vector<fr> const inputs = {
-        contract_address.to_field(),
-        nullifier,
-    };
+    if constexpr (std::is_same_v<NCT, aztec3::utils::types::NativeTypes>) {
+        return cached_compress(
+            get_silo_cache(), contract_address.to_field(), nullifier, aztec3::GeneratorIndex::OUTER_NULLIFIER);
+    } else {
+        std::array<fr, 2> const inputs = {
+            contract_address.to_field(),
+            nullifier,
+        };
 
-    return NCT::compress(inputs, aztec3::GeneratorIndex::OUTER_NULLIFIER);
+        return NCT::compress(inputs, aztec3::GeneratorIndex::OUTER_NULLIFIER);
+    }
 }
 
 /**
@@ -151,18 +310,102 @@ typename NCT::fr root_from_sibling_path(typename NCT::fr const& leaf,
     return node;  // root
 }
 
-template <typename NCT, typename Composer, size_t SIZE>
+/**
+ * @brief Check that `value` is the leaf at `index` of the tree of root `root`
+ *
+ * @param msg Describes the tree being checked, for the failure message. Either a string, or a callable returning one
+ * when it has to be formatted, so that it is only formatted if the check fails.
+ */
+template <typename NCT, typename Composer, size_t SIZE, typename Message>
 void check_membership(Composer& composer,
                       typename NCT::fr const& value,
                       typename NCT::fr const& index,
                       std::array<typename NCT::fr, SIZE> const& sibling_path,
                       typename NCT::fr const& root,
-                      std::string const& msg)
+                      Message const& msg)
 {
     const auto calculated_root = root_from_sibling_path<NCT>(value, index, sibling_path);
-    composer.do_assert(calculated_root == root,
-                       std::string("Membership check failed: ") + msg,
-                       aztec3::utils::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+    composer.do_assert(
+        calculated_root == root,
+        [&] {
+            if constexpr (std::is_invocable_r_v<std::string, Message const&>) {
+                return "Membership check failed: " + msg();
+            } else {
+                return "Membership check failed: " + std::string(msg);
+            }
+        },
+        aztec3::utils::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+}
+
+/**
+ * @brief Calculate the Merkle tree roots of several leaves from their sibling paths, natively.
+ *
+ * @details As `root_from_sibling_path` for each leaf, but a level of all the paths at a time: the pairs of a level are
+ * hashed with one `merkle_hash_batch`, which shares one inversion among them rather than taking one per pair.
+ *
+ * @tparam N The number of elements in each sibling path
+ * @param nodes The leaves, which are replaced by their roots
+ * @param leaf_indices The index of each leaf
+ * @param sibling_paths The sibling path of each leaf
+ */
+template <size_t N>
+void roots_from_sibling_paths(
+    std::span<aztec3::utils::types::NativeTypes::fr> nodes,
+    std::span<aztec3::utils::types::NativeTypes::fr const> leaf_indices,
+    std::span<std::array<aztec3::utils::types::NativeTypes::fr, N> const* const> sibling_paths)
+{
+    ASSERT(leaf_indices.size() == nodes.size() && sibling_paths.size() == nodes.size());
+    if (nodes.empty()) {
+        return;
+    }
+
+    std::vector<uint256_t> indices(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        indices[i] = leaf_indices[i];
+    }
+
+    std::vector<aztec3::utils::types::NativeTypes::fr> children(2 * nodes.size());
+    for (size_t level = 0; level < N; level++) {
+        for (size_t i = 0; i < nodes.size(); i++) {
+            auto const& sibling = (*sibling_paths[i])[level];
+            if (indices[i] & 1) {
+                children[2 * i] = sibling;
+                children[2 * i + 1] = nodes[i];
+            } else {
+                children[2 * i] = nodes[i];
+                children[2 * i + 1] = sibling;
+            }
+            indices[i] >>= uint256_t(1);
+        }
+        aztec3::utils::types::NativeTypes::merkle_hash_batch(children, nodes);
+    }
+}
+
+/**
+ * @brief Check that each of `values` is the leaf at its index of the tree of root `root`, natively.
+ *
+ * @details As `check_membership` for each value, with the roots of all the paths calculated together (see
+ * `roots_from_sibling_paths`).
+ *
+ * @param msg Describes the tree being checked, for the failure message of the `i`th value: a callable taking `i` and
+ * returning a string, only called if that check fails.
+ */
+template <size_t N, typename Composer, typename Message>
+void check_memberships(Composer& composer,
+                       std::span<aztec3::utils::types::NativeTypes::fr const> values,
+                       std::span<aztec3::utils::types::NativeTypes::fr const> indices,
+                       std::span<std::array<aztec3::utils::types::NativeTypes::fr, N> const* const> sibling_paths,
+                       aztec3::utils::types::NativeTypes::fr const& root,
+                       Message const& msg)
+{
+    std::vector<aztec3::utils::types::NativeTypes::fr> calculated_roots(values.begin(), values.end());
+    roots_from_sibling_paths<N>(calculated_roots, indices, sibling_paths);
+    for (size_t i = 0; i < calculated_roots.size(); i++) {
+        composer.do_assert(
+            calculated_roots[i] == root,
+            [&] { return "Membership check failed: " + msg(i); },
+            aztec3::utils::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+    }
 }
 
 /**
@@ -228,9 +471,78 @@ template <typename NCT> typename NCT::fr contract_tree_root_from_siblings(
     return computed_contract_tree_root;
 }
 
+// The deepest tree we ever need an empty subtree root or empty sibling path for
+constexpr size_t MAX_ZERO_HASHES_DEPTH = PUBLIC_DATA_TREE_HEIGHT;
+
+using ZeroHashes = std::array<aztec3::utils::types::NativeTypes::fr, MAX_ZERO_HASHES_DEPTH + 1>;
+
+/**
+ * @brief Compute the roots of empty subtrees of every depth for a given zero leaf.
+ *
+ * @param zero_leaf the leaf value that corresponds to a zero preimage
+ * @return ZeroHashes where entry `i` is the root of an empty subtree of depth `i` (entry 0 is the zero leaf itself)
+ */
+inline ZeroHashes compute_zero_hashes(aztec3::utils::types::NativeTypes::fr const& zero_leaf)
+{
+    ZeroHashes zero_hashes;
+    zero_hashes[0] = zero_leaf;
+    for (size_t i = 1; i < zero_hashes.size(); i++) {
+        zero_hashes[i] = aztec3::utils::types::NativeTypes::merkle_hash(zero_hashes[i - 1], zero_hashes[i - 1]);
+    }
+    return zero_hashes;
+}
+
+/**
+ * @brief Get the process-wide table of empty subtree roots for a given zero leaf.
+ *
+ * @details Tables are computed lazily, once per distinct zero leaf (e.g. 0 for the rollup trees, or the hash of an
+ * empty FunctionLeafPreimage for function trees), and are never freed, so the returned reference stays valid for the
+ * life of the process. The common zero-valued leaf is served from its own static without taking a lock.
+ *
+ * @param zero_leaf the leaf value that corresponds to a zero preimage
+ * @return ZeroHashes const& where entry `i` is the root of an empty subtree of depth `i`
+ */
+inline ZeroHashes const& get_zero_hashes(aztec3::utils::types::NativeTypes::fr const& zero_leaf)
+{
+    using fr = aztec3::utils::types::NativeTypes::fr;
+
+    static const ZeroHashes ZERO_LEAF_HASHES = compute_zero_hashes(fr(0));
+    if (zero_leaf == fr(0)) {
+        return ZERO_LEAF_HASHES;
+    }
+
+    // map nodes are never erased, so references to the tables outlive the lock
+    static std::map<uint256_t, std::unique_ptr<const ZeroHashes>> tables;
+#ifndef NO_MULTITHREADING
+    static std::mutex tables_mutex;
+    std::lock_guard<std::mutex> const lock(tables_mutex);
+#endif
+    auto& table = tables[uint256_t(zero_leaf)];
+    if (!table) {
+        table = std::make_unique<const ZeroHashes>(compute_zero_hashes(zero_leaf));
+    }
+    return *table;
+}
+
+/**
+ * @brief Get the root of an empty tree (or subtree) of a given depth.
+ *
+ * @param depth must be <= MAX_ZERO_HASHES_DEPTH
+ * @param zero_leaf the leaf value that corresponds to a zero preimage
+ * @return NativeTypes::fr
+ */
+inline aztec3::utils::types::NativeTypes::fr get_empty_tree_root(
+    size_t depth, aztec3::utils::types::NativeTypes::fr const& zero_leaf = 0)
+{
+    ASSERT(depth <= MAX_ZERO_HASHES_DEPTH);
+    return get_zero_hashes(zero_leaf)[depth];
+}
+
 /**
  * @brief Compute sibling path for an empty tree.
  *
+ * @details Native paths are read from the process-wide zero-hash table rather than rehashed on every call.
+ *
  * @tparam NCT (native or circuit)
  * @tparam TREE_HEIGHT
  * @param zero_leaf the leaf value that corresponds to a zero preimage
@@ -240,9 +552,15 @@ template <typename NCT, size_t TREE_HEIGHT>
 std::array<typename NCT::fr, TREE_HEIGHT> compute_empty_sibling_path(typename NCT::fr const& zero_leaf)
 {
     std::array<typename NCT::fr, TREE_HEIGHT> sibling_path = { zero_leaf };
-    for (size_t i = 1; i < TREE_HEIGHT; i++) {
-        // hash previous sibling with itself to get node above
-        sibling_path[i] = NCT::merkle_hash(sibling_path[i - 1], sibling_path[i - 1]);
+    if constexpr (std::is_same_v<NCT, aztec3::utils::types::NativeTypes>) {
+        static_assert(TREE_HEIGHT <= MAX_ZERO_HASHES_DEPTH);
+        auto const& zero_hashes = get_zero_hashes(zero_leaf);
+        std::copy(zero_hashes.begin(), zero_hashes.begin() + TREE_HEIGHT, sibling_path.begin());
+    } else {
+        for (size_t i = 1; i < TREE_HEIGHT; i++) {
+            // hash previous sibling with itself to get node above
+            sibling_path[i] = NCT::merkle_hash(sibling_path[i - 1], sibling_path[i - 1]);
+        }
     }
     return sibling_path;
 }
@@ -268,7 +586,13 @@ template <typename NCT> typename NCT::fr compute_public_data_tree_value(typename
 template <typename NCT> typename NCT::fr compute_public_data_tree_index(typename NCT::fr const& contract_address,
                                                                         typename NCT::fr const& storage_slot)
 {
-    return NCT::compress({ contract_address, storage_slot }, GeneratorIndex::PUBLIC_LEAF_INDEX);
+    if constexpr (std::is_same_v<NCT, aztec3::utils::types::NativeTypes>) {
+        return cached_compress(
+            get_public_data_tree_index_cache(), contract_address, storage_slot, GeneratorIndex::PUBLIC_LEAF_INDEX);
+    } else {
+        return NCT::compress(std::array<typename NCT::fr, 2>{ contract_address, storage_slot },
+                             GeneratorIndex::PUBLIC_LEAF_INDEX);
+    }
 }
 
 template <typename NCT> typename NCT::fr compute_l2_to_l1_hash(typename NCT::address contract_address,
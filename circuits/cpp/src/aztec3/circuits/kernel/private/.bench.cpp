@@ -0,0 +1,88 @@
+#include "index.hpp"
+#include "init.hpp"
+#include "utils.hpp"
+
+#include "aztec3/circuits/abis/private_kernel/private_kernel_inputs_inner.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/types/fixed_base_pedersen.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+namespace {
+
+using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInner;
+using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
+
+#ifdef COUNT_PEDERSEN_COMPRESSIONS
+using aztec3::utils::types::fixed_base_pedersen::num_compressions;
+
+size_t get_num_compressions()
+{
+    return num_compressions.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Report the Pedersen compressions per iteration, in builds configured with COUNT_PEDERSEN_COMPRESSIONS
+ */
+void report_compressions(benchmark::State& state, size_t start_compressions)
+{
+    auto const compressions = get_num_compressions() - start_compressions;
+    state.counters["pedersen_compressions"] =
+        benchmark::Counter(static_cast<double>(compressions), benchmark::Counter::kAvgIterations);
+}
+#else
+size_t get_num_compressions()
+{
+    return 0;
+}
+
+void report_compressions(benchmark::State& /*unused*/, size_t /*unused*/) {}
+#endif
+
+/**
+ * @brief A private call whose call stack is full, each preimage calling a distinct function
+ */
+PrivateCallData<NT> private_call_with_full_call_stack()
+{
+    PrivateCallData<NT> private_call;
+    private_call.vk = dummy_previous_kernel().vk;
+    for (size_t i = 0; i < PRIVATE_CALL_STACK_LENGTH; i++) {
+        auto& preimage = private_call.private_call_stack_preimages[i];
+        preimage.contract_address = NT::address(NT::fr(i + 1));
+        preimage.function_data.function_selector = static_cast<uint32_t>(i + 1);
+        preimage.public_inputs.args[0] = NT::fr(i);
+        private_call.call_stack_item.public_inputs.private_call_stack[i] = preimage.hash();
+    }
+    return private_call;
+}
+
+/**
+ * @brief An inner iteration of the native private kernel, reporting Pedersen compressions per iteration
+ */
+void native_private_kernel_inner_iteration(benchmark::State& state)
+{
+    auto const private_call = private_call_with_full_call_stack();
+    auto previous_kernel = dummy_previous_kernel();
+    previous_kernel.public_inputs.end.private_call_stack[0] = private_call.call_stack_item.hash();
+    previous_kernel.public_inputs.is_private = true;
+    PrivateKernelInputsInner<NT> const private_inputs = { .previous_kernel = previous_kernel,
+                                                          .private_call = private_call };
+
+    auto const start_compressions = get_num_compressions();
+    for (auto _ : state) {
+        DummyComposer composer = DummyComposer("private_kernel_bench__native_private_kernel_inner_iteration");
+        benchmark::DoNotOptimize(native_private_kernel_circuit_inner(composer, private_inputs));
+    }
+    report_compressions(state, start_compressions);
+}
+BENCHMARK(native_private_kernel_inner_iteration);
+
+}  // namespace
+
+}  // namespace aztec3::circuits::kernel::private_kernel
+
+BENCHMARK_MAIN();
@@ -22,6 +22,7 @@
 #include "aztec3/circuits/apps/test_apps/escrow/deposit.hpp"
 #include "aztec3/circuits/hash.hpp"
 #include "aztec3/circuits/kernel/private/utils.hpp"
+#include "aztec3/circuits/kernel/proving_key_cache.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
 
@@ -32,6 +33,8 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 namespace {
 
 using aztec3::circuits::compute_empty_sibling_path;
@@ -58,9 +61,14 @@ using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInner;
 using aztec3::circuits::apps::test_apps::basic_contract_deployment::constructor;
 using aztec3::circuits::apps::test_apps::escrow::deposit;
 
+using aztec3::circuits::kernel::CircuitType;
+using aztec3::circuits::kernel::get_circuit_shape;
+using aztec3::circuits::kernel::read_cached_keys;
+
 using DummyComposer = aztec3::utils::DummyComposer;
 
 using CircuitErrorCode = aztec3::utils::CircuitErrorCode;
+using aztec3::utils::CircuitError;
 
 // A type representing any private circuit function
 // (for now it works for deposit and constructor)
@@ -633,13 +641,13 @@ TEST(private_kernel_tests, circuit_create_proof_cbinds)
     //***************************************************************************
     // TODO might be able to get rid of proving key buffer
     uint8_t const* pk_buf = nullptr;
-    private_kernel__init_proving_key(&pk_buf);
-    // info("Proving key size: ", pk_size);
+    size_t const pk_size = private_kernel__init_proving_key(&pk_buf);
+    ASSERT_GT(pk_size, static_cast<size_t>(0));
 
     // TODO might be able to get rid of verification key buffer
-    // uint8_t const* vk_buf;
-    // size_t vk_size = private_kernel__init_verification_key(pk_buf, &vk_buf);
-    // info("Verification key size: ", vk_size);
+    uint8_t const* vk_buf = nullptr;
+    size_t const vk_size = private_kernel__init_verification_key(pk_buf, &vk_buf);
+    ASSERT_GT(vk_size, static_cast<size_t>(0));
 
     std::vector<uint8_t> signed_constructor_tx_request_vec;
     write(signed_constructor_tx_request_vec, private_inputs.signed_tx_request);
@@ -672,14 +680,320 @@ TEST(private_kernel_tests, circuit_create_proof_cbinds)
                                                          pk_buf,
                                                          true,  // first iteration
                                                          &proof_data_buf);
-    (void)proof_data_size;
-    // info("Proof size: ", proof_data_size);
+    ASSERT_GT(proof_data_size, static_cast<size_t>(0));
     // info("PublicInputs size: ", public_inputs_size);
 
+    // Proving again reuses the keys cached by the first proof
+    uint8_t const* second_proof_data_buf = nullptr;
+    size_t const second_proof_data_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                                nullptr,  // no previous kernel on first iteration
+                                                                private_constructor_call_vec.data(),
+                                                                pk_buf,
+                                                                true,  // first iteration
+                                                                &second_proof_data_buf);
+    ASSERT_EQ(second_proof_data_size, proof_data_size);
+
     free((void*)pk_buf);
-    // free((void*)vk_buf);
+    free((void*)vk_buf);
     free((void*)proof_data_buf);
+    free((void*)second_proof_data_buf);
+    free((void*)public_inputs_buf);
+}
+
+/**
+ * @brief The cbind writes the public inputs to the caller's buffer once it is large enough
+ */
+TEST(private_kernel_tests, native_sim_into_cbind)
+{
+    auto const& private_inputs =
+        do_private_call_get_kernel_inputs_init(true, constructor, { NT::fr(5), NT::fr(1), NT::fr(999) });
+
+    std::vector<uint8_t> signed_tx_request_vec;
+    write(signed_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_call_vec;
+    write(private_call_vec, private_inputs.private_call);
+
+    uint8_t const* expected_public_inputs_buf = nullptr;
+    size_t expected_public_inputs_size = 0;
+    uint8_t* const sim_failure_ptr = private_kernel__sim(signed_tx_request_vec.data(),
+                                                         nullptr,  // no previous kernel on first iteration
+                                                         private_call_vec.data(),
+                                                         true,  // first iteration
+                                                         &expected_public_inputs_size,
+                                                         &expected_public_inputs_buf);
+    ASSERT_TRUE(sim_failure_ptr == nullptr);
+
+    // a buffer too small is left untouched, the size of the public inputs being returned
+    std::vector<uint8_t> public_inputs_vec(1, 0xab);
+    size_t public_inputs_size = 0;
+    uint8_t* const small_failure_ptr = private_kernel__sim_into(signed_tx_request_vec.data(),
+                                                                nullptr,
+                                                                private_call_vec.data(),
+                                                                true,
+                                                                public_inputs_vec.data(),
+                                                                public_inputs_vec.size(),
+                                                                &public_inputs_size);
+    ASSERT_TRUE(small_failure_ptr == nullptr);
+    ASSERT_EQ(public_inputs_size, expected_public_inputs_size);
+    ASSERT_EQ(public_inputs_vec[0], 0xab);
+
+    public_inputs_vec.resize(public_inputs_size);
+    uint8_t* const failure_ptr = private_kernel__sim_into(signed_tx_request_vec.data(),
+                                                          nullptr,
+                                                          private_call_vec.data(),
+                                                          true,
+                                                          public_inputs_vec.data(),
+                                                          public_inputs_vec.size(),
+                                                          &public_inputs_size);
+    ASSERT_TRUE(failure_ptr == nullptr);
+    ASSERT_EQ(public_inputs_size, expected_public_inputs_size);
+    for (size_t i = 0; i < public_inputs_size; i++) {
+        ASSERT_EQ(public_inputs_vec[i], expected_public_inputs_buf[i]);
+    }
+
+    free((void*)expected_public_inputs_buf);
+}
+
+/**
+ * @brief A simulation kept by the cbind is proven without passing its inputs again
+ */
+TEST(private_kernel_tests, circuit_prove_simulated_cbinds)
+{
+    auto const& private_inputs =
+        do_private_call_get_kernel_inputs_init(true, constructor, { NT::fr(5), NT::fr(1), NT::fr(999) });
+
+    std::vector<uint8_t> signed_tx_request_vec;
+    write(signed_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_call_vec;
+    write(private_call_vec, private_inputs.private_call);
+
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    uint32_t simulation_id = 0;
+    uint8_t* const sim_failure_ptr = private_kernel__sim_for_proof(signed_tx_request_vec.data(),
+                                                                   nullptr,  // no previous kernel on first iteration
+                                                                   private_call_vec.data(),
+                                                                   true,  // first iteration
+                                                                   &public_inputs_size,
+                                                                   &public_inputs_buf,
+                                                                   &simulation_id);
+    ASSERT_TRUE(sim_failure_ptr == nullptr);
+    ASSERT_NE(simulation_id, 0U);
+
+    uint8_t const* proof_data_buf = nullptr;
+    size_t proof_data_size = 0;
+    uint8_t* const prove_failure_ptr =
+        private_kernel__prove_simulated(simulation_id, &proof_data_size, &proof_data_buf);
+    ASSERT_TRUE(prove_failure_ptr == nullptr);
+    ASSERT_GT(proof_data_size, static_cast<size_t>(0));
+
+    // proving released the simulation
+    ASSERT_FALSE(private_kernel__release_simulation(simulation_id));
+    uint8_t const* unknown_proof_data_buf = nullptr;
+    size_t unknown_proof_data_size = 0;
+    uint8_t* const unknown_failure_ptr =
+        private_kernel__prove_simulated(simulation_id, &unknown_proof_data_size, &unknown_proof_data_buf);
+    ASSERT_TRUE(unknown_failure_ptr != nullptr);
+    ASSERT_EQ(unknown_proof_data_size, static_cast<size_t>(0));
+    CircuitError failure;
+    uint8_t const* failure_it = unknown_failure_ptr;
+    read(failure_it, failure);
+    ASSERT_EQ(failure.code, CircuitErrorCode::PRIVATE_KERNEL__UNKNOWN_SIMULATION);
+
     free((void*)public_inputs_buf);
+    free((void*)proof_data_buf);
+    free(unknown_failure_ptr);
+}
+
+/**
+ * @brief Circuits of the same size but different structure have different shapes, so they don't share keys
+ */
+TEST(private_kernel_tests, circuit_shapes_tell_apart_circuits_of_the_same_size)
+{
+    using CT = aztec3::utils::types::CircuitTypes<Composer>;
+    auto const get_shape = [](bool multiply) {
+        Composer composer = Composer("../barretenberg/cpp/srs_db/ignition");
+        auto const x = CT::fr(CT::witness(&composer, 2));
+        auto const y = CT::fr(CT::witness(&composer, 3));
+        auto const result = multiply ? x * y : x + y;
+        result.assert_equal(CT::fr(CT::witness(&composer, multiply ? 6 : 5)));
+        return get_circuit_shape(composer);
+    };
+
+    auto const product_shape = get_shape(true);
+    auto const sum_shape = get_shape(false);
+    ASSERT_EQ(product_shape.num_gates, sum_shape.num_gates);
+    EXPECT_NE(product_shape.digest, sum_shape.digest);
+    EXPECT_EQ(get_shape(true), product_shape);
+}
+
+/**
+ * @brief The keys written by the cbind are read back from disk unchanged
+ */
+TEST(private_kernel_tests, circuit_proving_keys_round_trip_through_disk)
+{
+    auto const dir = (std::filesystem::temp_directory_path() / "private_kernel_tests_proving_keys").string();
+    ASSERT_TRUE(private_kernel__write_proving_keys(dir.c_str()));
+
+    uint8_t const* vk_buf = nullptr;
+    size_t const vk_size = private_kernel__init_verification_key(nullptr, &vk_buf);
+    std::vector<uint8_t> const first_iteration_vk_vec(vk_buf, vk_buf + vk_size);
+    free((void*)vk_buf);
+    std::vector<uint8_t> mock_kernel_vk_vec;
+    write(mock_kernel_vk_vec, *utils::dummy_previous_kernel(true).vk);
+
+    auto const stored_keys = read_cached_keys(dir);
+    size_t num_checked = 0;
+    for (auto const& stored : stored_keys) {
+        std::vector<uint8_t> vk_vec;
+        write(vk_vec, *stored.keys.verification_key);
+        EXPECT_EQ(stored.keys.proving_key->circuit_size, stored.keys.verification_key->circuit_size);
+        if (stored.type == CircuitType::MOCK_KERNEL) {
+            EXPECT_EQ(vk_vec, mock_kernel_vk_vec);
+            num_checked++;
+        } else if (stored.type == CircuitType::PRIVATE_KERNEL_FIRST_ITERATION && vk_vec == first_iteration_vk_vec) {
+            num_checked++;
+        }
+    }
+    EXPECT_EQ(num_checked, static_cast<size_t>(2));
+
+    // this process already has these keys
+    EXPECT_EQ(private_kernel__load_proving_keys(dir.c_str()), static_cast<size_t>(0));
+
+    // the keys of a circuit whose files were truncated are skipped rather than read
+    for (auto const& circuit_dir : std::filesystem::directory_iterator(dir)) {
+        if (circuit_dir.is_directory()) {
+            auto const keys_path = circuit_dir.path() / "keys";
+            std::filesystem::resize_file(keys_path, std::filesystem::file_size(keys_path) / 2);
+            break;
+        }
+    }
+    EXPECT_EQ(read_cached_keys(dir).size(), stored_keys.size() - 1);
+    std::filesystem::remove_all(dir);
+}
+
+/**
+ * @brief A private call failing several checks only reports the first of them in fail-fast mode
+ */
+TEST(private_kernel_tests, native_fail_fast_stops_at_first_failure)
+{
+    NT::fr const& amount = 5;
+    NT::fr const& asset_id = 1;
+    NT::fr const& memo = 999;
+
+    auto private_inputs = do_private_call_get_kernel_inputs_init(false, deposit, { amount, asset_id, memo });
+    private_inputs.private_call.call_stack_item.public_inputs.call_context.is_delegate_call = true;
+    private_inputs.private_call.call_stack_item.public_inputs.call_context.is_static_call = true;
+
+    DummyComposer composer = DummyComposer("private_kernel_tests__native_fail_fast_stops_at_first_failure");
+    native_private_kernel_circuit_initial(composer, private_inputs);
+    ASSERT_GT(composer.failure_msgs.size(), static_cast<size_t>(1));
+
+    DummyComposer fail_fast_composer =
+        DummyComposer("private_kernel_tests__native_fail_fast_stops_at_first_failure-fail_fast", true);
+    native_private_kernel_circuit_initial(fail_fast_composer, private_inputs);
+    ASSERT_EQ(fail_fast_composer.failure_msgs.size(), static_cast<size_t>(1));
+    ASSERT_EQ(fail_fast_composer.get_first_failure().code, composer.get_first_failure().code);
+    ASSERT_EQ(fail_fast_composer.get_first_failure().message, composer.get_first_failure().message);
+
+    // Again via the cbind
+    std::vector<uint8_t> signed_tx_request_vec;
+    write(signed_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_call_vec;
+    write(private_call_vec, private_inputs.private_call);
+
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    // no previous kernel on first iteration
+    uint8_t* const circuit_failure_ptr = private_kernel__sim_fail_fast(
+        signed_tx_request_vec.data(), nullptr, private_call_vec.data(), true, &public_inputs_size, &public_inputs_buf);
+    ASSERT_TRUE(circuit_failure_ptr != nullptr);
+
+    CircuitError failure;
+    uint8_t const* failure_it = circuit_failure_ptr;
+    read(failure_it, failure);
+    ASSERT_EQ(failure.code, composer.get_first_failure().code);
+
+    free((void*)circuit_failure_ptr);
+    free((void*)public_inputs_buf);
+}
+
+/**
+ * @brief A session accumulates the same public inputs as iterations simulated one by one, skipping a failed one
+ */
+TEST(private_kernel_tests, native_session_matches_separate_iterations)
+{
+    NT::fr const& amount = 5;
+    NT::fr const& asset_id = 1;
+    NT::fr const& memo = 999;
+
+    // a first call whose only nested call is a second one
+    auto private_inputs = do_private_call_get_kernel_inputs_init(false, deposit, { amount, asset_id, memo });
+    auto const second_call = private_inputs.private_call;
+    private_inputs.private_call.call_stack_item.public_inputs.private_call_stack[0] =
+        second_call.call_stack_item.hash();
+
+    DummyComposer composer = DummyComposer("private_kernel_tests__native_session_matches_separate_iterations");
+    auto previous_kernel = utils::dummy_previous_kernel();
+    previous_kernel.public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
+    auto const expected_public_inputs = native_private_kernel_circuit_inner(
+        composer, PrivateKernelInputsInner<NT>{ .previous_kernel = previous_kernel, .private_call = second_call });
+    ASSERT_FALSE(composer.failed());
+
+    std::vector<uint8_t> signed_tx_request_vec;
+    write(signed_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> first_call_vec;
+    write(first_call_vec, private_inputs.private_call);
+    std::vector<uint8_t> second_call_vec;
+    write(second_call_vec, second_call);
+
+    // a call that is not the one on the call stack
+    auto wrong_call = second_call;
+    wrong_call.call_stack_item.public_inputs.args[0] += 1;
+    std::vector<uint8_t> wrong_call_vec;
+    write(wrong_call_vec, wrong_call);
+
+    uint32_t const session_id = private_kernel__session_begin(signed_tx_request_vec.data());
+    ASSERT_TRUE(private_kernel__session_step(session_id, first_call_vec.data()) == nullptr);
+    // a failed iteration leaves the session as it was
+    uint8_t* const wrong_call_failure_ptr = private_kernel__session_step(session_id, wrong_call_vec.data());
+    EXPECT_TRUE(wrong_call_failure_ptr != nullptr);
+    free((void*)wrong_call_failure_ptr);
+    ASSERT_TRUE(private_kernel__session_step(session_id, second_call_vec.data()) == nullptr);
+
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t const public_inputs_size = private_kernel__session_finish(session_id, &public_inputs_buf);
+    std::vector<uint8_t> expected_public_inputs_vec;
+    write(expected_public_inputs_vec, expected_public_inputs);
+    EXPECT_EQ(std::vector<uint8_t>(public_inputs_buf, public_inputs_buf + public_inputs_size),
+              expected_public_inputs_vec);
+    free((void*)public_inputs_buf);
+
+    // a finished session is gone
+    EXPECT_EQ(private_kernel__session_finish(session_id, &public_inputs_buf), static_cast<size_t>(0));
+    uint8_t* const failure_ptr = private_kernel__session_step(session_id, second_call_vec.data());
+    ASSERT_TRUE(failure_ptr != nullptr);
+    CircuitError failure;
+    uint8_t const* failure_it = failure_ptr;
+    read(failure_it, failure);
+    EXPECT_EQ(failure.code, CircuitErrorCode::PRIVATE_KERNEL__UNKNOWN_SESSION);
+    free((void*)failure_ptr);
+}
+
+/**
+ * @brief The dummy previous kernel is only built once
+ */
+TEST(private_kernel_tests, native_dummy_previous_kernel_is_cached)
+{
+    auto const& first = utils::dummy_previous_kernel();
+    auto const& second = utils::dummy_previous_kernel();
+    EXPECT_EQ(&first, &second);
+
+    // copies can be modified without affecting the cached one, but share its vk
+    auto copy = utils::dummy_previous_kernel();
+    copy.public_inputs.end.private_call_stack[0] = 1;
+    EXPECT_EQ(utils::dummy_previous_kernel().public_inputs.end.private_call_stack[0], NT::fr(0));
+    EXPECT_EQ(copy.vk, first.vk);
 }
 
 /**
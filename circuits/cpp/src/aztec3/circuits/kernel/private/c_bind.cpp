@@ -5,14 +5,26 @@
 
 #include "aztec3/circuits/abis/combined_constant_data.hpp"
 #include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/kernel/proving_key_cache.hpp"
+#include "aztec3/utils/sim_batch.hpp"
+#include "aztec3/utils/write_to_buffer.hpp"
 
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/srs/reference_string/env_reference_string.hpp"
 #include <barretenberg/serialize/cbind.hpp>
 
+#include <map>
+#include <memory>
+#include <utility>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
 namespace {
 using Composer = plonk::UltraComposer;
 using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
+using CircuitErrorCode = aztec3::utils::CircuitErrorCode;
 using aztec3::circuits::abis::KernelCircuitPublicInputs;
 using aztec3::circuits::abis::PreviousKernelData;
 using aztec3::circuits::abis::SignedTxRequest;
@@ -23,15 +35,51 @@ using aztec3::circuits::kernel::private_kernel::native_private_kernel_circuit_in
 using aztec3::circuits::kernel::private_kernel::native_private_kernel_circuit_inner;
 using aztec3::circuits::kernel::private_kernel::private_kernel_circuit;
 using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
+using aztec3::circuits::kernel::CircuitKeys;
+using aztec3::circuits::kernel::CircuitType;
+using aztec3::circuits::kernel::get_circuit_keys;
+using aztec3::circuits::kernel::get_crs_factory;
+using aztec3::circuits::kernel::load_cached_keys;
+using aztec3::circuits::kernel::prove_with_cached_keys;
+using aztec3::circuits::kernel::write_cached_keys;
+using aztec3::utils::simulate_serialized_batch;
+using aztec3::utils::write_to_buffer;
+
+/**
+ * @brief The keys of the first iteration of the private kernel, computed once on placeholder inputs
+ *
+ * @details The placeholder private call is a default one whose vk and proof are those of the mock kernel. A circuit
+ * built for an app whose vk has another shape has another size: its keys are computed and cached on its first proof.
+ */
+CircuitKeys const& get_first_iteration_keys()
+{
+    static CircuitKeys const& keys = []() -> CircuitKeys const& {
+        auto const& mock_kernel = dummy_previous_kernel(true);
+        PrivateCallData<NT> const private_call = { .proof = mock_kernel.proof, .vk = mock_kernel.vk };
+        PreviousKernelData<NT> previous_kernel = mock_kernel;
+        previous_kernel.public_inputs.end.private_call_stack[0] = private_call.call_stack_item.hash();
+        previous_kernel.public_inputs.is_private = true;
+
+        Composer composer = Composer(get_crs_factory());
+        private_kernel_circuit(composer,
+                               PrivateKernelInputsInner<NT>{ .previous_kernel = previous_kernel,
+                                                             .private_call = private_call },
+                               true);
+        return get_circuit_keys(CircuitType::PRIVATE_KERNEL_FIRST_ITERATION, composer);
+    }();
+    return keys;
+}
 
 }  // namespace
 
 // WASM Cbinds
 
-// TODO(dbanks12): might be able to get rid of proving key buffer
+// Computes (once per process) the proving key of the first iteration of the private kernel, see
+// get_first_iteration_keys, and returns it serialized
 WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf)
 {
-    std::vector<uint8_t> pk_vec(42, 0);
+    std::vector<uint8_t> pk_vec;
+    write(pk_vec, *get_first_iteration_keys().proving_key);
 
     auto* raw_buf = (uint8_t*)malloc(pk_vec.size());
     memcpy(raw_buf, (void*)pk_vec.data(), pk_vec.size());
@@ -40,15 +88,14 @@ WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf)
     return pk_vec.size();
 }
 
+// Same as private_kernel__init_proving_key, for the verification key
 WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf, uint8_t const** vk_buf)
 {
+    // the keys are taken from the process-level cache rather than deserialized
     (void)pk_buf;
 
-    // TODO(dbanks12) actual verification key?
-    // NT:VKData vk_data = { 0 };
-
-    std::vector<uint8_t> vk_vec(42, 0);
-    // write(vk_vec, vk_data);
+    std::vector<uint8_t> vk_vec;
+    write(vk_vec, *get_first_iteration_keys().verification_key);
 
     auto* raw_buf = (uint8_t*)malloc(vk_vec.size());
     memcpy(raw_buf, (void*)vk_vec.data(), vk_vec.size());
@@ -57,29 +104,144 @@ WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf,
     return vk_vec.size();
 }
 
+// Writes the keys of the first iteration of the private kernel and of the mock kernel, with any other kernel keys this
+// process computed, to the directory `dir` (see write_cached_keys). Returns whether they were all written.
+WASM_EXPORT bool private_kernel__write_proving_keys(char const* dir)
+{
+    // computes the keys of the mock kernel as well
+    get_first_iteration_keys();
+    return write_cached_keys(dir);
+}
+
+// Loads the keys written by private_kernel__write_proving_keys to the directory `dir`, whose polynomials are
+// memory-mapped, so that this process does not compute them. Returns the number of circuits whose keys were loaded.
+WASM_EXPORT size_t private_kernel__load_proving_keys(char const* dir)
+{
+    return load_cached_keys(dir);
+}
+
 CBIND(private_kernel__dummy_previous_kernel, []() { return dummy_previous_kernel(); });
 
 
-// TODO(jeanmon) We will need two versions of this one to expose to ts.
-// First let us try to get it compiled with one function (the inner one).
+namespace {
+/**
+ * @brief Objects handed to the host by id, for a later cbind to use them without passing them back
+ *
+ * @details Objects are shared: one found by a cbind stays alive until it is done with it, even if another cbind takes
+ * it from the registry meanwhile.
+ */
+template <typename T> class HandleRegistry {
+  public:
+    uint32_t add(std::shared_ptr<T> value)
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(mutex);
+#endif
+        uint32_t const id = next_id++;
+        values[id] = std::move(value);
+        return id;
+    }
 
-// TODO(dbanks12): comment about how public_inputs is a confusing name
-// returns size of public inputs
-WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
-                                         uint8_t const* previous_kernel_buf,
-                                         uint8_t const* private_call_buf,
-                                         bool first_iteration,
-                                         size_t* private_kernel_public_inputs_size_out,
-                                         uint8_t const** private_kernel_public_inputs_buf)
+    /**
+     * @brief The object `id`, or nullptr if it was never added or is already taken
+     */
+    std::shared_ptr<T> find(uint32_t id)
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(mutex);
+#endif
+        auto const it = values.find(id);
+        return it == values.end() ? nullptr : it->second;
+    }
+
+    /**
+     * @brief Remove the object `id`, returning it, or nullptr if it was never added or is already taken
+     */
+    std::shared_ptr<T> take(uint32_t id)
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(mutex);
+#endif
+        std::shared_ptr<T> value;
+        auto const it = values.find(id);
+        if (it != values.end()) {
+            value = std::move(it->second);
+            values.erase(it);
+        }
+        return value;
+    }
+
+  private:
+    std::map<uint32_t, std::shared_ptr<T>> values;
+    // 0 is never an id
+    uint32_t next_id = 1;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+};
+
+/**
+ * @brief The previous kernel the circuit of a first iteration takes: the mock kernel, whose call stack holds the call
+ * of `private_call_data`
+ */
+PreviousKernelData<NT> first_iteration_previous_kernel(SignedTxRequest<NT> const& signed_tx_request,
+                                                       PrivateCallData<NT> const& private_call_data)
+{
+    PreviousKernelData<NT> previous_kernel = dummy_previous_kernel(true);
+
+    previous_kernel.public_inputs.end.private_call_stack[0] = private_call_data.call_stack_item.hash();
+    previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots.private_data_tree_root =
+        private_call_data.call_stack_item.public_inputs.historic_private_data_tree_root;
+    previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots.nullifier_tree_root =
+        private_call_data.call_stack_item.public_inputs.historic_nullifier_tree_root;
+    previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots.contract_tree_root =
+        private_call_data.call_stack_item.public_inputs.historic_contract_tree_root;
+    previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots
+        .l1_to_l2_messages_tree_root =
+        private_call_data.call_stack_item.public_inputs.historic_l1_to_l2_messages_tree_root;
+    previous_kernel.public_inputs.constants.tx_context = signed_tx_request.tx_request.tx_context;
+    previous_kernel.public_inputs.is_private = true;
+    return previous_kernel;
+}
+
+/**
+ * @brief A successful simulation of the private kernel, kept for `private_kernel__prove_simulated`
+ */
+struct Simulation {
+    // the inputs of the circuit, parsed once by the simulation
+    PrivateKernelInputsInner<NT> circuit_inputs;
+    bool first_iteration = false;
+    // the public inputs of the native kernel
+    KernelCircuitPublicInputs<NT> public_inputs;
+};
+
+HandleRegistry<Simulation>& get_simulation_registry()
+{
+    static HandleRegistry<Simulation> registry;
+    return registry;
+}
+
+/**
+ * @brief Run the native private kernel on the serialized inputs of `private_kernel__sim`
+ *
+ * @param simulation_id_out If not null, a successful simulation is kept (see `private_kernel__sim_for_proof`) and its
+ * id written there, 0 being written for a failed one
+ */
+KernelCircuitPublicInputs<NT> run_private_kernel(DummyComposer& composer,
+                                                 uint8_t const* signed_tx_request_buf,
+                                                 uint8_t const* previous_kernel_buf,
+                                                 uint8_t const* private_call_buf,
+                                                 bool first_iteration,
+                                                 uint32_t* simulation_id_out = nullptr)
 {
-    DummyComposer composer = DummyComposer("private_kernel__sim");
     PrivateCallData<NT> private_call_data;
     read(private_call_buf, private_call_data);
 
     KernelCircuitPublicInputs<NT> public_inputs = KernelCircuitPublicInputs<NT>{};
+    SignedTxRequest<NT> signed_tx_request;
+    PreviousKernelData<NT> previous_kernel;
 
     if (first_iteration) {
-        SignedTxRequest<NT> signed_tx_request;
         read(signed_tx_request_buf, signed_tx_request);
 
         // Assert that previous_kernel_buf is empty (i.e. nullptr)
@@ -92,7 +254,6 @@ WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
 
         public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
     } else {
-        PreviousKernelData<NT> previous_kernel;
         read(previous_kernel_buf, previous_kernel);
 
         PrivateKernelInputsInner<NT> const private_inputs = PrivateKernelInputsInner<NT>{
@@ -103,6 +264,42 @@ WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
         public_inputs = native_private_kernel_circuit_inner(composer, private_inputs);
     }
 
+    if (simulation_id_out != nullptr) {
+        *simulation_id_out = 0;
+        if (!composer.failed()) {
+            auto simulation = std::make_shared<Simulation>();
+            simulation->circuit_inputs.previous_kernel =
+                first_iteration ? first_iteration_previous_kernel(signed_tx_request, private_call_data)
+                                : std::move(previous_kernel);
+            simulation->circuit_inputs.private_call = std::move(private_call_data);
+            simulation->first_iteration = first_iteration;
+            simulation->public_inputs = public_inputs;
+            *simulation_id_out = get_simulation_registry().add(std::move(simulation));
+        }
+    }
+    return public_inputs;
+}
+
+/**
+ * @brief Simulate the private kernel, see `private_kernel__sim`
+ *
+ * @param fail_fast Whether the simulation stops at the first failure (the only one reported) rather than running to
+ * completion
+ */
+uint8_t* simulate_private_kernel(std::string const& method_name,
+                                 bool fail_fast,
+                                 uint8_t const* signed_tx_request_buf,
+                                 uint8_t const* previous_kernel_buf,
+                                 uint8_t const* private_call_buf,
+                                 bool first_iteration,
+                                 size_t* private_kernel_public_inputs_size_out,
+                                 uint8_t const** private_kernel_public_inputs_buf,
+                                 uint32_t* simulation_id_out = nullptr)
+{
+    DummyComposer composer = DummyComposer(method_name, fail_fast);
+    KernelCircuitPublicInputs<NT> const public_inputs = run_private_kernel(
+        composer, signed_tx_request_buf, previous_kernel_buf, private_call_buf, first_iteration, simulation_id_out);
+
     // serialize public inputs to bytes vec
     std::vector<uint8_t> public_inputs_vec;
     write(public_inputs_vec, public_inputs);
@@ -114,6 +311,286 @@ WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
     return composer.alloc_and_serialize_first_failure();
 }
 
+/**
+ * @brief Check the outputs of the private kernel circuit against those of the native kernel simulated on the same
+ * inputs
+ *
+ * @details Every output is compared, except for those the circuit does not compute as the native kernels do yet,
+ * which are taken from the simulation:
+ * - end.aggregation_object: the circuit aggregates the proofs it verifies, the native kernels verify none
+ * - end.new_nullifiers: the circuit pushes neither the tx hash and nonce nullifiers of a first iteration, nor the
+ *   contract address nullifier after the call's nullifiers
+ * - end.private_call_stack: the circuit does not pop the call it executes
+ * - end.public_call_stack and end.new_l2_to_l1_msgs: the circuit does not push those of the call
+ * - end.new_contracts: the circuit pushes the contract data of every call, not only of contract deployments
+ */
+void assert_circuit_outputs_match_simulation(DummyComposer& composer,
+                                             KernelCircuitPublicInputs<NT> const& circuit_outputs,
+                                             KernelCircuitPublicInputs<NT> const& simulation_outputs)
+{
+    KernelCircuitPublicInputs<NT> compared_outputs = circuit_outputs;
+    compared_outputs.end.aggregation_object = simulation_outputs.end.aggregation_object;
+    compared_outputs.end.new_nullifiers = simulation_outputs.end.new_nullifiers;
+    compared_outputs.end.private_call_stack = simulation_outputs.end.private_call_stack;
+    compared_outputs.end.public_call_stack = simulation_outputs.end.public_call_stack;
+    compared_outputs.end.new_l2_to_l1_msgs = simulation_outputs.end.new_l2_to_l1_msgs;
+    compared_outputs.end.new_contracts = simulation_outputs.end.new_contracts;
+
+    composer.do_assert(compared_outputs == simulation_outputs,
+                       "circuit outputs do not match the simulation",
+                       CircuitErrorCode::PRIVATE_KERNEL__CIRCUIT_OUTPUTS_MISMATCH_SIMULATION);
+}
+
+/**
+ * @brief Prove the private kernel circuit on `private_inputs`, writing the proof to `proof_data_buf`
+ *
+ * @return The public inputs of the circuit
+ */
+KernelCircuitPublicInputs<NT> prove_private_kernel(PrivateKernelInputsInner<NT> const& private_inputs,
+                                                   bool first_iteration,
+                                                   size_t* proof_data_size_out,
+                                                   uint8_t const** proof_data_buf)
+{
+    Composer private_kernel_composer = Composer(get_crs_factory());
+    auto const public_inputs = private_kernel_circuit(private_kernel_composer, private_inputs, first_iteration);
+    NT::Proof const private_kernel_proof = prove_with_cached_keys(
+        first_iteration ? CircuitType::PRIVATE_KERNEL_FIRST_ITERATION : CircuitType::PRIVATE_KERNEL_INNER,
+        private_kernel_composer);
+
+    // copy proof data to output buffer
+    auto* raw_proof_buf = (uint8_t*)malloc(private_kernel_proof.proof_data.size());
+    memcpy(raw_proof_buf, (void*)private_kernel_proof.proof_data.data(), private_kernel_proof.proof_data.size());
+    *proof_data_buf = raw_proof_buf;
+    *proof_data_size_out = private_kernel_proof.proof_data.size();
+    return public_inputs;
+}
+
+}  // namespace
+
+// TODO(jeanmon) We will need two versions of this one to expose to ts.
+// First let us try to get it compiled with one function (the inner one).
+
+// TODO(dbanks12): comment about how public_inputs is a confusing name
+// returns size of public inputs
+WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
+                                         uint8_t const* previous_kernel_buf,
+                                         uint8_t const* private_call_buf,
+                                         bool first_iteration,
+                                         size_t* private_kernel_public_inputs_size_out,
+                                         uint8_t const** private_kernel_public_inputs_buf)
+{
+    return simulate_private_kernel("private_kernel__sim",
+                                   false,
+                                   signed_tx_request_buf,
+                                   previous_kernel_buf,
+                                   private_call_buf,
+                                   first_iteration,
+                                   private_kernel_public_inputs_size_out,
+                                   private_kernel_public_inputs_buf);
+}
+
+// Same as private_kernel__sim, but stops at the first failure. Use it to cheaply reject invalid transactions.
+WASM_EXPORT uint8_t* private_kernel__sim_fail_fast(uint8_t const* signed_tx_request_buf,
+                                                   uint8_t const* previous_kernel_buf,
+                                                   uint8_t const* private_call_buf,
+                                                   bool first_iteration,
+                                                   size_t* private_kernel_public_inputs_size_out,
+                                                   uint8_t const** private_kernel_public_inputs_buf)
+{
+    return simulate_private_kernel("private_kernel__sim_fail_fast",
+                                   true,
+                                   signed_tx_request_buf,
+                                   previous_kernel_buf,
+                                   private_call_buf,
+                                   first_iteration,
+                                   private_kernel_public_inputs_size_out,
+                                   private_kernel_public_inputs_buf);
+}
+
+// Same as private_kernel__sim, but the public inputs are written to the caller's buffer
+// `private_kernel_public_inputs_buf` of `private_kernel_public_inputs_capacity` bytes (see write_to_buffer): their size
+// is written to `private_kernel_public_inputs_size_out`, and nothing is written to the buffer if they don't fit.
+WASM_EXPORT uint8_t* private_kernel__sim_into(uint8_t const* signed_tx_request_buf,
+                                              uint8_t const* previous_kernel_buf,
+                                              uint8_t const* private_call_buf,
+                                              bool first_iteration,
+                                              uint8_t* private_kernel_public_inputs_buf,
+                                              size_t private_kernel_public_inputs_capacity,
+                                              size_t* private_kernel_public_inputs_size_out)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_into");
+    *private_kernel_public_inputs_size_out = write_to_buffer(
+        run_private_kernel(composer, signed_tx_request_buf, previous_kernel_buf, private_call_buf, first_iteration),
+        private_kernel_public_inputs_buf,
+        private_kernel_public_inputs_capacity);
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Simulates each private kernel iteration of the vector `private_inputs_buf`, in parallel on native builds: a vector
+// of PrivateKernelInputsInit for first iterations, of PrivateKernelInputsInner otherwise. Writes the vector of their
+// public inputs and first failures (SimBatchResult) to `results_buf`, and returns its size.
+WASM_EXPORT size_t private_kernel__sim_batch(uint8_t const* private_inputs_buf,
+                                             bool first_iteration,
+                                             uint8_t const** results_buf)
+{
+    if (first_iteration) {
+        return simulate_serialized_batch<PrivateKernelInputsInit<NT>>(
+            "private_kernel__sim_batch",
+            private_inputs_buf,
+            results_buf,
+            [](DummyComposer& composer, PrivateKernelInputsInit<NT> const& private_inputs) {
+                return native_private_kernel_circuit_initial(composer, private_inputs);
+            });
+    }
+    return simulate_serialized_batch<PrivateKernelInputsInner<NT>>(
+        "private_kernel__sim_batch",
+        private_inputs_buf,
+        results_buf,
+        [](DummyComposer& composer, PrivateKernelInputsInner<NT> const& private_inputs) {
+            return native_private_kernel_circuit_inner(composer, private_inputs);
+        });
+}
+
+// Same as private_kernel__sim, but a successful simulation is kept, with its inputs parsed and the circuit inputs of
+// a first iteration built, and its id written to `simulation_id_out` (0 if the simulation failed). Pass the id to
+// private_kernel__prove_simulated rather than the same buffers to private_kernel__prove, or release it with
+// private_kernel__release_simulation.
+WASM_EXPORT uint8_t* private_kernel__sim_for_proof(uint8_t const* signed_tx_request_buf,
+                                                   uint8_t const* previous_kernel_buf,
+                                                   uint8_t const* private_call_buf,
+                                                   bool first_iteration,
+                                                   size_t* private_kernel_public_inputs_size_out,
+                                                   uint8_t const** private_kernel_public_inputs_buf,
+                                                   uint32_t* simulation_id_out)
+{
+    return simulate_private_kernel("private_kernel__sim_for_proof",
+                                   false,
+                                   signed_tx_request_buf,
+                                   previous_kernel_buf,
+                                   private_call_buf,
+                                   first_iteration,
+                                   private_kernel_public_inputs_size_out,
+                                   private_kernel_public_inputs_buf,
+                                   simulation_id_out);
+}
+
+// Proves the private kernel on the inputs of a simulation kept by private_kernel__sim_for_proof, which is released.
+// The circuit outputs are checked against those of the simulation. Returns the first failure serialized (an unknown
+// simulation or a mismatch, with no proof written), or nullptr.
+WASM_EXPORT uint8_t* private_kernel__prove_simulated(uint32_t simulation_id,
+                                                     size_t* proof_data_size_out,
+                                                     uint8_t const** proof_data_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__prove_simulated");
+    *proof_data_size_out = 0;
+    *proof_data_buf = nullptr;
+    auto const simulation = get_simulation_registry().take(simulation_id);
+    if (!simulation) {
+        composer.do_assert(false,
+                           [&] { return format("unknown private kernel simulation ", simulation_id); },
+                           CircuitErrorCode::PRIVATE_KERNEL__UNKNOWN_SIMULATION);
+        return composer.alloc_and_serialize_first_failure();
+    }
+
+    auto const public_inputs = prove_private_kernel(
+        simulation->circuit_inputs, simulation->first_iteration, proof_data_size_out, proof_data_buf);
+
+    assert_circuit_outputs_match_simulation(composer, public_inputs, simulation->public_inputs);
+    if (composer.failed()) {
+        free((void*)*proof_data_buf);
+        *proof_data_size_out = 0;
+        *proof_data_buf = nullptr;
+    }
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Releases a simulation kept by private_kernel__sim_for_proof that won't be proven. Returns whether it was kept.
+WASM_EXPORT bool private_kernel__release_simulation(uint32_t simulation_id)
+{
+    return get_simulation_registry().take(simulation_id) != nullptr;
+}
+
+namespace {
+using aztec3::circuits::kernel::private_kernel::PrivateKernelSession;
+
+/**
+ * @brief A session handed to the host, whose steps and finish are serialised
+ */
+struct SessionHandle {
+    explicit SessionHandle(SignedTxRequest<NT> signed_tx_request) : session(std::move(signed_tx_request)) {}
+
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    PrivateKernelSession session;
+};
+
+HandleRegistry<SessionHandle>& get_session_registry()
+{
+    static HandleRegistry<SessionHandle> registry;
+    return registry;
+}
+}  // namespace
+
+// Begins a session simulating the private kernel iterations of the transaction of `signed_tx_request_buf`, whose
+// public inputs are kept in memory between iterations (see PrivateKernelSession). Returns the id of the session.
+WASM_EXPORT uint32_t private_kernel__session_begin(uint8_t const* signed_tx_request_buf)
+{
+    SignedTxRequest<NT> signed_tx_request;
+    read(signed_tx_request_buf, signed_tx_request);
+
+    return get_session_registry().add(std::make_shared<SessionHandle>(std::move(signed_tx_request)));
+}
+
+// Simulates the kernel iteration of the next private call of a session, the first one being the initial iteration.
+// Returns the first failure of the iteration serialized, or nullptr. A failed iteration leaves the session as it was.
+// Concurrent steps of a session run one after the other, in no set order.
+WASM_EXPORT uint8_t* private_kernel__session_step(uint32_t session_id, uint8_t const* private_call_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__session_step");
+    auto const handle = get_session_registry().find(session_id);
+    if (!handle) {
+        composer.do_assert(false,
+                           [&] { return format("unknown private kernel session ", session_id); },
+                           CircuitErrorCode::PRIVATE_KERNEL__UNKNOWN_SESSION);
+        return composer.alloc_and_serialize_first_failure();
+    }
+
+    PrivateCallData<NT> private_call_data;
+    read(private_call_buf, private_call_data);
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(handle->mutex);
+#endif
+        handle->session.step(composer, std::move(private_call_data));
+    }
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Finishes a session, writing the public inputs accumulated by its iterations to `private_kernel_public_inputs_buf`.
+// Returns their size, or 0 (writing nullptr) for an unknown session. A step still running finishes first.
+WASM_EXPORT size_t private_kernel__session_finish(uint32_t session_id,
+                                                  uint8_t const** private_kernel_public_inputs_buf)
+{
+    auto const handle = get_session_registry().take(session_id);
+    if (!handle) {
+        *private_kernel_public_inputs_buf = nullptr;
+        return 0;
+    }
+
+    std::vector<uint8_t> public_inputs_vec;
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(handle->mutex);
+#endif
+        write(public_inputs_vec, handle->session.get_public_inputs());
+    }
+    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
+    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
+    *private_kernel_public_inputs_buf = raw_public_inputs_buf;
+    return public_inputs_vec.size();
+}
+
 // TODO(jeanmon): We currently only support inner variant because the circuit version
 // was not splitted into inner/init counterparts. Once this is done, we have to modify
 // the below method to dispatch over the two variants based on first_iteration boolean.
@@ -125,10 +602,9 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
                                          bool first_iteration,
                                          uint8_t const** proof_data_buf)
 {
-    // TODO(dbanks12) might be able to get rid of proving key buffer
-    // TODO(dbanks12) do we want to accept it or just get it from our factory?
+    // The proving key is taken from the process-level cache (computed on the first proof of a circuit of this size)
+    // rather than deserialized.
     (void)pk_buf;  // unused
-    auto crs_factory = std::make_shared<EnvReferenceStringFactory>();
 
     SignedTxRequest<NT> signed_tx_request;
     read(signed_tx_request_buf, signed_tx_request);
@@ -138,18 +614,7 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
 
     PreviousKernelData<NT> previous_kernel;
     if (first_iteration) {
-        previous_kernel = dummy_previous_kernel(true);
-
-        previous_kernel.public_inputs.end.private_call_stack[0] = private_call_data.call_stack_item.hash();
-        previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots.private_data_tree_root =
-            private_call_data.call_stack_item.public_inputs.historic_private_data_tree_root;
-        previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots.contract_tree_root =
-            private_call_data.call_stack_item.public_inputs.historic_contract_tree_root;
-        previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots
-            .l1_to_l2_messages_tree_root =
-            private_call_data.call_stack_item.public_inputs.historic_l1_to_l2_messages_tree_root;
-        previous_kernel.public_inputs.constants.tx_context = signed_tx_request.tx_request.tx_context;
-        previous_kernel.public_inputs.is_private = true;
+        previous_kernel = first_iteration_previous_kernel(signed_tx_request, private_call_data);
     } else {
         read(previous_kernel_buf, previous_kernel);
     }
@@ -158,22 +623,12 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
         .private_call = private_call_data,
     };
 
-    Composer private_kernel_composer = Composer(crs_factory);
-    auto private_kernel_prover = private_kernel_composer.create_prover();
-
-    KernelCircuitPublicInputs<NT> public_inputs;
-    public_inputs = private_kernel_circuit(private_kernel_composer, private_inputs, first_iteration);
-    NT::Proof private_kernel_proof;
-    private_kernel_proof = private_kernel_prover.construct_proof();
-
-    // copy proof data to output buffer
-    auto* raw_proof_buf = (uint8_t*)malloc(private_kernel_proof.proof_data.size());
-    memcpy(raw_proof_buf, (void*)private_kernel_proof.proof_data.data(), private_kernel_proof.proof_data.size());
-    *proof_data_buf = raw_proof_buf;
+    size_t proof_data_size = 0;
+    prove_private_kernel(private_inputs, first_iteration, &proof_data_size, proof_data_buf);
 
     // TODO(rahul) - for whenever we end up using this method is TS, we need to figure a way for bberg's composer to
     // serialise errors.
-    return private_kernel_proof.proof_data.size();
+    return proof_data_size;
 }
 
 WASM_EXPORT size_t private_kernel__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length)
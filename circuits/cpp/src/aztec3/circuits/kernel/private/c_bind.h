@@ -6,6 +6,8 @@
 
 WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf);
 WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf, uint8_t const** vk_buf);
+WASM_EXPORT bool private_kernel__write_proving_keys(char const* dir);
+WASM_EXPORT size_t private_kernel__load_proving_keys(char const* dir);
 CBIND_DECL(private_kernel__dummy_previous_kernel);
 WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
                                          uint8_t const* previous_kernel_buf,
@@ -13,6 +15,37 @@ WASM_EXPORT uint8_t* private_kernel__sim(uint8_t const* signed_tx_request_buf,
                                          bool first_iteration,
                                          size_t* private_kernel_public_inputs_size_out,
                                          uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_fail_fast(uint8_t const* signed_tx_request_buf,
+                                                   uint8_t const* previous_kernel_buf,
+                                                   uint8_t const* private_call_buf,
+                                                   bool first_iteration,
+                                                   size_t* private_kernel_public_inputs_size_out,
+                                                   uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_into(uint8_t const* signed_tx_request_buf,
+                                              uint8_t const* previous_kernel_buf,
+                                              uint8_t const* private_call_buf,
+                                              bool first_iteration,
+                                              uint8_t* private_kernel_public_inputs_buf,
+                                              size_t private_kernel_public_inputs_capacity,
+                                              size_t* private_kernel_public_inputs_size_out);
+WASM_EXPORT size_t private_kernel__sim_batch(uint8_t const* private_inputs_buf,
+                                             bool first_iteration,
+                                             uint8_t const** results_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_for_proof(uint8_t const* signed_tx_request_buf,
+                                                   uint8_t const* previous_kernel_buf,
+                                                   uint8_t const* private_call_buf,
+                                                   bool first_iteration,
+                                                   size_t* private_kernel_public_inputs_size_out,
+                                                   uint8_t const** private_kernel_public_inputs_buf,
+                                                   uint32_t* simulation_id_out);
+WASM_EXPORT uint8_t* private_kernel__prove_simulated(uint32_t simulation_id,
+                                                     size_t* proof_data_size_out,
+                                                     uint8_t const** proof_data_buf);
+WASM_EXPORT bool private_kernel__release_simulation(uint32_t simulation_id);
+WASM_EXPORT uint32_t private_kernel__session_begin(uint8_t const* signed_tx_request_buf);
+WASM_EXPORT uint8_t* private_kernel__session_step(uint32_t session_id, uint8_t const* private_call_buf);
+WASM_EXPORT size_t private_kernel__session_finish(uint32_t session_id,
+                                                  uint8_t const** private_kernel_public_inputs_buf);
 WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
                                          uint8_t const* previous_kernel_buf,
                                          uint8_t const* private_call_buf,
@@ -39,7 +39,7 @@ void common_validate_call_stack(DummyComposer& composer, PrivateCallData<NT> con
         // Assumes `hash == 0` means "this stack item is empty".
         const auto calculated_hash = hash == 0 ? 0 : preimage.hash();
         composer.do_assert(hash == calculated_hash,
-                           format("private_call_stack[", i, "] = ", hash, "; does not reconcile"),
+                           [&] { return format("private_call_stack[", i, "] = ", hash, "; does not reconcile"); },
                            CircuitErrorCode::PRIVATE_KERNEL__PRIVATE_CALL_STACK_ITEM_HASH_MISMATCH);
     }
 }
@@ -124,8 +124,7 @@ void common_contract_logic(DummyComposer& composer,
     const auto& portal_contract_address = private_call.portal_contract_address;
     const auto& deployer_address = private_call_public_inputs.call_context.msg_sender;
 
-    const auto private_call_vk_hash =
-        stdlib::recursion::verification_key<CT::bn254>::compress_native(private_call.vk, GeneratorIndex::VK);
+    const auto private_call_vk_hash = compute_vk_hash<CT>(private_call.vk);
 
     const auto is_contract_deployment = public_inputs.constants.tx_context.is_contract_deployment_tx;
 
@@ -1,4 +1,5 @@
 #include "init.hpp"
 #include "native_private_kernel_circuit_init.hpp"
 #include "native_private_kernel_circuit_inner.hpp"
-#include "private_kernel_circuit.hpp"
\ No newline at end of file
+#include "private_kernel_circuit.hpp"
+#include "session.hpp"
\ No newline at end of file
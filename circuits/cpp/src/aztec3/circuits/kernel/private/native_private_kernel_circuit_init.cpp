@@ -155,6 +155,9 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_initial(DummyCompose
     initialise_end_values(private_inputs, public_inputs);
 
     validate_inputs(composer, private_inputs);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // TODO(rahul) FIXME - https://github.com/AztecProtocol/aztec-packages/issues/499
     // Noir doesn't have hash index so it can't hash private call stack item correctly
@@ -168,6 +171,9 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_initial(DummyCompose
     update_end_values(private_inputs, public_inputs);
 
     common_update_end_values(composer, private_inputs.private_call, public_inputs);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     common_contract_logic(composer,
                           private_inputs.private_call,
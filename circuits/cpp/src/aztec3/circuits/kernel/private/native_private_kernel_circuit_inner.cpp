@@ -63,12 +63,14 @@ void initialise_end_values(PrivateKernelInputsInner<NT> const& private_inputs,
 
 void validate_this_private_call_hash(DummyComposer& composer,
                                      PrivateKernelInputsInner<NT> const& private_inputs,
-                                     KernelCircuitPublicInputs<NT>& public_inputs)
+                                     KernelCircuitPublicInputs<NT>& public_inputs,
+                                     CallStackItemHashes& call_stack_item_hashes)
 {
     // TODO: this logic might need to change to accommodate the weird edge 3 initial txs (the 'main' tx, the 'fee' tx,
     // and the 'gas rebate' tx).
     const auto popped_private_call_hash = array_pop(public_inputs.end.private_call_stack);
-    const auto calculated_this_private_call_hash = private_inputs.private_call.call_stack_item.hash();
+    const auto calculated_this_private_call_hash =
+        call_stack_item_hashes.hash(private_inputs.private_call.call_stack_item);
 
     composer.do_assert(
         popped_private_call_hash == calculated_this_private_call_hash,
@@ -76,7 +78,9 @@ void validate_this_private_call_hash(DummyComposer& composer,
         CircuitErrorCode::PRIVATE_KERNEL__CALCULATED_PRIVATE_CALL_HASH_AND_PROVIDED_PRIVATE_CALL_HASH_MISMATCH);
 };
 
-void validate_this_private_call_stack(DummyComposer& composer, PrivateKernelInputsInner<NT> const& private_inputs)
+void validate_this_private_call_stack(DummyComposer& composer,
+                                      PrivateKernelInputsInner<NT> const& private_inputs,
+                                      CallStackItemHashes& call_stack_item_hashes)
 {
     const auto& stack = private_inputs.private_call.call_stack_item.public_inputs.private_call_stack;
     const auto& preimages = private_inputs.private_call.private_call_stack_preimages;
@@ -86,9 +90,9 @@ void validate_this_private_call_stack(DummyComposer& composer, PrivateKernelInpu
 
         // Note: this assumes it's computationally infeasible to have `0` as a valid call_stack_item_hash.
         // Assumes `hash == 0` means "this stack item is empty".
-        const auto calculated_hash = hash == 0 ? 0 : preimage.hash();
+        const auto calculated_hash = hash == 0 ? 0 : call_stack_item_hashes.hash(preimage);
         composer.do_assert(hash == calculated_hash,
-                           format("private_call_stack[", i, "] = ", hash, "; does not reconcile"),
+                           [&] { return format("private_call_stack[", i, "] = ", hash, "; does not reconcile"); },
                            CircuitErrorCode::PRIVATE_KERNEL__PRIVATE_CALL_STACK_ITEM_HASH_MISMATCH);
     }
 };
@@ -139,6 +143,15 @@ void validate_inputs(DummyComposer& composer, PrivateKernelInputsInner<NT> const
 // ensure we're constraining everything.
 KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer& composer,
                                                                   PrivateKernelInputsInner<NT> const& private_inputs)
+{
+    // a single iteration has no other iteration to share hashes with
+    CallStackItemHashes call_stack_item_hashes(0);
+    return native_private_kernel_circuit_inner(composer, private_inputs, call_stack_item_hashes);
+}
+
+KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer& composer,
+                                                                  PrivateKernelInputsInner<NT> const& private_inputs,
+                                                                  CallStackItemHashes& call_stack_item_hashes)
 {
     // We'll be pushing data to this during execution of this circuit.
     KernelCircuitPublicInputs<NT> public_inputs{};
@@ -148,11 +161,14 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer&
 
     validate_inputs(composer, private_inputs);
 
-    validate_this_private_call_hash(composer, private_inputs, public_inputs);
+    validate_this_private_call_hash(composer, private_inputs, public_inputs, call_stack_item_hashes);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // TODO(rahul) FIXME - https://github.com/AztecProtocol/aztec-packages/issues/499
     // Noir doesn't have hash index so it can't hash private call stack item correctly
-    // validate_this_private_call_stack(composer, private_inputs);
+    // validate_this_private_call_stack(composer, private_inputs, call_stack_item_hashes);
 
     // TODO(dbanks12): may need to comment out hash check in here according to TODO above
     // TODO(jeanmon) FIXME - https://github.com/AztecProtocol/aztec-packages/issues/671
@@ -162,6 +178,9 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer&
 
     // ensure that historic/purported contract tree root matches the one in previous kernel
     validate_contract_tree_root(composer, private_inputs);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     const auto private_call_stack_item = private_inputs.private_call.call_stack_item;
     common_contract_logic(composer,
@@ -2,6 +2,8 @@
 
 #include "init.hpp"
 
+#include "aztec3/circuits/abis/call_stack_item.hpp"
+#include "aztec3/circuits/abis/hash_memo.hpp"
 #include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
 #include "aztec3/circuits/abis/private_kernel/private_kernel_inputs_inner.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
@@ -12,7 +14,18 @@ using aztec3::circuits::abis::KernelCircuitPublicInputs;
 using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInner;
 using DummyComposer = aztec3::utils::DummyComposer;
 
+// The hashes of the private call stack items hashed by the iterations of a transaction, see `abis::HashMemo`
+using CallStackItemHashes = aztec3::circuits::abis::HashMemo<abis::CallStackItem<NT, abis::PrivateTypes>>;
+
 KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer& composer,
                                                                   PrivateKernelInputsInner<NT> const& _private_inputs);
 
+/**
+ * @brief Same as `native_private_kernel_circuit_inner(composer, private_inputs)`, hashing the call stack items through
+ * `call_stack_item_hashes`, which the iterations of a transaction share
+ */
+KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer& composer,
+                                                                  PrivateKernelInputsInner<NT> const& private_inputs,
+                                                                  CallStackItemHashes& call_stack_item_hashes);
+
 }  // namespace aztec3::circuits::kernel::private_kernel
\ No newline at end of file
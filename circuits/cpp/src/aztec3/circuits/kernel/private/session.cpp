@@ -0,0 +1,57 @@
+#include "session.hpp"
+
+#include "native_private_kernel_circuit_init.hpp"
+#include "native_private_kernel_circuit_inner.hpp"
+#include "utils.hpp"
+
+#include "aztec3/circuits/abis/private_kernel/private_kernel_inputs_init.hpp"
+#include "aztec3/circuits/abis/private_kernel/private_kernel_inputs_inner.hpp"
+#include "aztec3/utils/array.hpp"
+#include "aztec3/utils/circuit_errors.hpp"
+
+#include <utility>
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInit;
+using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInner;
+using aztec3::utils::array_length;
+using CircuitErrorCode = aztec3::utils::CircuitErrorCode;
+
+void PrivateKernelSession::step(DummyComposer& composer, PrivateCallData<NT> private_call)
+{
+    if (num_steps == 0) {
+        PrivateKernelInputsInit<NT> const private_inputs = {
+            .signed_tx_request = signed_tx_request,
+            .private_call = std::move(private_call),
+        };
+        auto next_public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
+        if (composer.failed()) {
+            return;
+        }
+        public_inputs = std::move(next_public_inputs);
+    } else {
+        // as the inner kernel pops the call from the stack, bail out before it throws on an empty one
+        if (array_length(public_inputs.end.private_call_stack) == 0) {
+            composer.do_assert(false,
+                               "Cannot execute private kernel circuit with an empty private call stack",
+                               CircuitErrorCode::PRIVATE_KERNEL__PRIVATE_CALL_STACK_EMPTY);
+            return;
+        }
+        PrivateKernelInputsInner<NT> private_inputs = {
+            .previous_kernel = utils::dummy_previous_kernel(),
+            .private_call = std::move(private_call),
+        };
+        private_inputs.previous_kernel.public_inputs = std::move(public_inputs);
+        auto next_public_inputs = native_private_kernel_circuit_inner(composer, private_inputs, call_stack_item_hashes);
+        if (composer.failed()) {
+            // the kernel only reads its inputs, so the public inputs it was given are intact
+            public_inputs = std::move(private_inputs.previous_kernel.public_inputs);
+            return;
+        }
+        public_inputs = std::move(next_public_inputs);
+    }
+    num_steps++;
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
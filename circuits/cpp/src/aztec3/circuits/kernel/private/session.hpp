@@ -0,0 +1,59 @@
+#pragma once
+
+#include "init.hpp"
+#include "native_private_kernel_circuit_inner.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/abis/private_kernel/private_call_data.hpp"
+#include "aztec3/circuits/abis/signed_tx_request.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::SignedTxRequest;
+using aztec3::circuits::abis::private_kernel::PrivateCallData;
+using DummyComposer = aztec3::utils::DummyComposer;
+
+/**
+ * @brief The native private kernel iterations of a transaction, whose accumulated public inputs stay in memory from
+ * one iteration to the next
+ *
+ * @details Simulating an iteration on its own takes the whole previous kernel (its public inputs, proof and vk) and
+ * returns new public inputs, which the caller passes back to the next iteration. A session keeps the public inputs
+ * instead, so that each iteration only takes its private call. The previous kernel of an inner iteration is the
+ * dummy one with the accumulated public inputs: sessions simulate, they don't prove.
+ *
+ * The call stack items hashed by an iteration stay memoised for the next ones (see `abis::HashMemo`), such as a call
+ * retried after its iteration failed.
+ */
+class PrivateKernelSession {
+  public:
+    explicit PrivateKernelSession(SignedTxRequest<NT> signed_tx_request)
+        : signed_tx_request(std::move(signed_tx_request))
+    {}
+
+    /**
+     * @brief Simulate the iteration of the next private call: the initial kernel for the first call of the session,
+     * an inner kernel for the others
+     *
+     * @details A failed iteration (see `composer.failed()`) leaves the session as it was, so the call can be retried.
+     */
+    void step(DummyComposer& composer, PrivateCallData<NT> private_call);
+
+    KernelCircuitPublicInputs<NT> const& get_public_inputs() const { return public_inputs; }
+
+    size_t get_num_steps() const { return num_steps; }
+
+  private:
+    SignedTxRequest<NT> signed_tx_request;
+    KernelCircuitPublicInputs<NT> public_inputs{};
+    size_t num_steps = 0;
+    // enough for the calls on the private call stack of the kernel
+    CallStackItemHashes call_stack_item_hashes{ KERNEL_PRIVATE_CALL_STACK_LENGTH };
+};
+
+}  // namespace aztec3::circuits::kernel::private_kernel
@@ -2,6 +2,7 @@
 #include "init.hpp"
 
 #include "aztec3/circuits/abis/new_contract_data.hpp"
+#include "aztec3/circuits/kernel/proving_key_cache.hpp"
 #include "aztec3/circuits/mock/mock_kernel_circuit.hpp"
 
 #include "barretenberg/proof_system/types/composer_type.hpp"
@@ -10,6 +11,10 @@ namespace {
 using NT = aztec3::utils::types::NativeTypes;
 using AggregationObject = aztec3::utils::types::NativeTypes::AggregationObject;
 using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::kernel::CircuitType;
+using aztec3::circuits::kernel::get_circuit_keys;
+using aztec3::circuits::kernel::get_crs_factory;
+using aztec3::circuits::kernel::prove_with_cached_keys;
 using aztec3::circuits::mock::mock_kernel_circuit;
 
 }  // namespace
@@ -37,28 +42,27 @@ std::shared_ptr<NT::VK> fake_vk()
     return std::make_shared<NT::VK>(std::move(vk_data), env_crs->get_verifier_crs());
 }
 
+namespace {
 /**
- * @brief Create a dummy "previous kernel"
- *
- * @details For use in the first iteration of the  kernel circuit
+ * @brief Build a dummy "previous kernel" by running the mock kernel circuit
  *
  * @param real_vk_proof should the vk and proof included be real and usable by real circuits?
  * @return PreviousKernelData<NT> the previous kernel data for use in the kernel circuit
  */
-PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false)
+PreviousKernelData<NT> build_dummy_previous_kernel(bool real_vk_proof)
 {
     PreviousKernelData<NT> const init_previous_kernel{};
 
-    auto crs_factory = std::make_shared<EnvReferenceStringFactory>();
-    Composer mock_kernel_composer = Composer(crs_factory);
+    Composer mock_kernel_composer = Composer(get_crs_factory());
     auto mock_kernel_public_inputs = mock_kernel_circuit(mock_kernel_composer, init_previous_kernel.public_inputs);
 
-    auto mock_kernel_prover = mock_kernel_composer.create_prover();
-    NT::Proof const mock_kernel_proof =
-        real_vk_proof ? mock_kernel_prover.construct_proof() : NT::Proof{ .proof_data = std::vector<uint8_t>(64, 0) };
+    // the keys of the mock kernel are cached (and possibly loaded from disk, see load_cached_keys)
+    NT::Proof const mock_kernel_proof = real_vk_proof
+                                            ? prove_with_cached_keys(CircuitType::MOCK_KERNEL, mock_kernel_composer)
+                                            : NT::Proof{ .proof_data = std::vector<uint8_t>(64, 0) };
 
     std::shared_ptr<NT::VK> const mock_kernel_vk =
-        real_vk_proof ? mock_kernel_composer.compute_verification_key() : fake_vk();
+        real_vk_proof ? get_circuit_keys(CircuitType::MOCK_KERNEL, mock_kernel_composer).verification_key : fake_vk();
 
     PreviousKernelData<NT> previous_kernel = {
         .public_inputs = mock_kernel_public_inputs,
@@ -72,5 +76,27 @@ PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false)
 
     return previous_kernel;
 }
+}  // namespace
+
+/**
+ * @brief Get a dummy "previous kernel"
+ *
+ * @details For use in the first iteration of the  kernel circuit. Its inputs never change, so it is only built (which
+ * means running the mock kernel circuit, and proving it for a real vk and proof) the first time it is requested for
+ * each value of `real_vk_proof`. Static local initialisation is thread-safe, so concurrent first calls build it once.
+ *
+ * @param real_vk_proof should the vk and proof included be real and usable by real circuits?
+ * @return PreviousKernelData<NT> const& the previous kernel data for use in the kernel circuit, valid for the lifetime
+ * of the process
+ */
+PreviousKernelData<NT> const& dummy_previous_kernel(bool real_vk_proof)
+{
+    if (real_vk_proof) {
+        static PreviousKernelData<NT> const real_previous_kernel = build_dummy_previous_kernel(true);
+        return real_previous_kernel;
+    }
+    static PreviousKernelData<NT> const fake_previous_kernel = build_dummy_previous_kernel(false);
+    return fake_previous_kernel;
+}
 
 }  // namespace aztec3::circuits::kernel::private_kernel::utils
\ No newline at end of file
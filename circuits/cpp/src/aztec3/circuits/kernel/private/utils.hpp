@@ -9,6 +9,7 @@ using aztec3::circuits::abis::PreviousKernelData;
 
 namespace aztec3::circuits::kernel::private_kernel::utils {
 
-PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false);
+// Built once per process: copy the result to modify it (the copies share its vk)
+PreviousKernelData<NT> const& dummy_previous_kernel(bool real_vk_proof = false);
 
 }  // namespace aztec3::circuits::kernel::private_kernel::utils
\ No newline at end of file
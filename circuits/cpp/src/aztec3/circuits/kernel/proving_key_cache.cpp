@@ -0,0 +1,448 @@
+#include "proving_key_cache.hpp"
+
+#include "aztec3/utils/shared_reference_string_factory.hpp"
+
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#ifndef __wasm__
+#include <filesystem>
+#include <fstream>
+#endif
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace aztec3::circuits::kernel {
+
+namespace {
+
+using aztec3::utils::SharedReferenceStringFactory;
+
+// "A3PK", at the start of every `keys` file
+constexpr uint32_t CACHED_KEYS_MAGIC = 0x4b503341;
+
+/**
+ * @brief A 64-bit digest of a sequence of words
+ *
+ * @details Tells apart the circuits built by this code base. It is not meant to resist collisions built on purpose.
+ */
+class Digest {
+  public:
+    void add(uint64_t word)
+    {
+        // splitmix64 finalizer
+        uint64_t z = (state ^ word) + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        state = z ^ (z >> 31);
+    }
+
+    void add(barretenberg::fr const& value)
+    {
+        for (auto const limb : value.data) {
+            add(limb);
+        }
+    }
+
+    template <typename T> void add(std::vector<T> const& values)
+    {
+        add(static_cast<uint64_t>(values.size()));
+        for (auto const& value : values) {
+            add(value);
+        }
+    }
+
+    void add_bytes(char const* bytes, size_t size)
+    {
+        add(static_cast<uint64_t>(size));
+        for (size_t offset = 0; offset < size; offset += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            memcpy(&word, bytes + offset, std::min(sizeof(uint64_t), size - offset));
+            add(word);
+        }
+    }
+
+    uint64_t value() const { return state; }
+
+  private:
+    uint64_t state = 0;
+};
+
+struct CacheEntry {
+#ifndef NO_MULTITHREADING
+    // held while computing or loading the keys, so that two threads never compute the same ones
+    std::mutex keys_mutex;
+    // held while proving, as the prover writes the witness polynomials into the shared proving key
+    std::mutex proving_mutex;
+#endif
+    // empty until computed or loaded, then never changed
+    CircuitKeys keys;
+};
+
+struct Cache {
+    // map nodes are never erased, so references to the entries outlive the lock
+    std::map<std::pair<CircuitType, CircuitShape>, std::unique_ptr<CacheEntry>> entries;
+#ifndef NO_MULTITHREADING
+    // only held to find or insert entries, so that circuits of other types and shapes are not blocked while keys are
+    // computed
+    std::mutex entries_mutex;
+#endif
+};
+
+Cache& get_cache()
+{
+    static Cache cache;
+    return cache;
+}
+
+CacheEntry& find_or_insert_entry(CircuitType type, CircuitShape const& shape)
+{
+    auto& cache = get_cache();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> const lock(cache.entries_mutex);
+#endif
+    auto& entry = cache.entries[{ type, shape }];
+    if (!entry) {
+        entry = std::make_unique<CacheEntry>();
+    }
+    return *entry;
+}
+
+CacheEntry& get_cache_entry(CircuitType type, plonk::UltraComposer& composer)
+{
+    auto& entry = find_or_insert_entry(type, get_circuit_shape(composer));
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> const lock(entry.keys_mutex);
+#endif
+    if (!entry.keys.proving_key) {
+        entry.keys = {
+            .proving_key = composer.compute_proving_key(),
+            .verification_key = composer.compute_verification_key(),
+        };
+    } else {
+        composer.circuit_proving_key = entry.keys.proving_key;
+        composer.circuit_verification_key = entry.keys.verification_key;
+    }
+    return entry;
+}
+
+/**
+ * @brief The keys of every circuit cached so far
+ */
+std::vector<StoredCircuitKeys> get_cached_keys()
+{
+    std::vector<StoredCircuitKeys> cached_keys;
+    auto& cache = get_cache();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> const lock(cache.entries_mutex);
+#endif
+    for (auto const& [circuit, entry] : cache.entries) {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const keys_lock(entry->keys_mutex);
+#endif
+        // skips the keys still being computed
+        if (entry->keys.proving_key) {
+            cached_keys.push_back({ .type = circuit.first, .shape = circuit.second, .keys = entry->keys });
+        }
+    }
+    return cached_keys;
+}
+
+#ifndef __wasm__
+std::string get_circuit_dir(std::string const& dir, CircuitType type, CircuitShape const& shape)
+{
+    return format(dir, "/", static_cast<uint32_t>(type), "_", shape.num_gates, "_", shape.digest);
+}
+
+/**
+ * @brief Digest the contents of the files written for a circuit: its `keys` file and its polynomial files
+ */
+bool digest_circuit_files(std::string const& circuit_dir, uint64_t& content_digest)
+{
+    std::error_code error;
+    std::vector<std::filesystem::path> files;
+    for (auto const& file : std::filesystem::directory_iterator(circuit_dir, error)) {
+        if (file.is_regular_file(error)) {
+            files.push_back(file.path());
+        }
+    }
+    if (error) {
+        return false;
+    }
+    std::sort(files.begin(), files.end());
+
+    Digest digest;
+    std::vector<char> chunk(size_t(1) << 20);
+    for (auto const& file : files) {
+        auto const name = file.filename().string();
+        digest.add_bytes(name.data(), name.size());
+        std::ifstream is(file, std::ios::binary);
+        while (is) {
+            is.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            digest.add_bytes(chunk.data(), static_cast<size_t>(is.gcount()));
+        }
+        if (!is.eof()) {
+            return false;
+        }
+    }
+    content_digest = digest.value();
+    return true;
+}
+
+/**
+ * @brief Write the keys of a circuit to their directory in `dir`, and digest what was written
+ */
+bool write_circuit_keys(std::string const& dir, StoredCircuitKeys const& stored, uint64_t& content_digest)
+{
+    using serialize::write;
+
+    auto const& [type, shape, keys] = stored;
+    auto const circuit_dir = get_circuit_dir(dir, type, shape);
+    std::error_code error;
+    std::filesystem::create_directories(circuit_dir, error);
+    std::ofstream os(circuit_dir + "/keys", std::ios::binary);
+    if (error || !os) {
+        return false;
+    }
+
+    write(os, CACHED_KEYS_MAGIC);
+    write(os, CACHED_KEYS_FORMAT_VERSION);
+    write(os, static_cast<uint32_t>(type));
+    write(os, static_cast<uint64_t>(shape.num_gates));
+    write(os, shape.digest);
+
+    std::vector<uint8_t> vk_buf;
+    write(vk_buf, *keys.verification_key);
+    write(os, static_cast<uint64_t>(vk_buf.size()));
+    os.write(reinterpret_cast<char const*>(vk_buf.data()), static_cast<std::streamsize>(vk_buf.size()));
+
+    // the metadata goes to `os`, each precomputed polynomial to its own file in `circuit_dir`
+    plonk::write_mmap(os, circuit_dir, *keys.proving_key);
+    os.close();
+    return os.good() && digest_circuit_files(circuit_dir, content_digest);
+}
+
+/**
+ * @brief Read the keys of a circuit from their directory in `dir`
+ *
+ * @details The files are rejected if their digest is not `content_digest`, or if the circuit they hold is not the
+ * one listed in the index. Sizes read from the files are checked against what is left to read.
+ */
+bool read_circuit_keys(std::string const& dir, StoredCircuitKeys& stored, uint64_t content_digest)
+{
+    using serialize::read;
+
+    auto const circuit_dir = get_circuit_dir(dir, stored.type, stored.shape);
+    uint64_t actual_content_digest = 0;
+    if (!digest_circuit_files(circuit_dir, actual_content_digest) || actual_content_digest != content_digest) {
+        return false;
+    }
+
+    auto const keys_path = circuit_dir + "/keys";
+    std::error_code error;
+    auto const keys_size = std::filesystem::file_size(keys_path, error);
+    std::ifstream is(keys_path, std::ios::binary);
+    if (error || !is.good()) {
+        return false;
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t type = 0;
+    uint64_t num_gates = 0;
+    uint64_t digest = 0;
+    read(is, magic);
+    read(is, version);
+    read(is, type);
+    read(is, num_gates);
+    read(is, digest);
+    if (!is.good() || magic != CACHED_KEYS_MAGIC || version != CACHED_KEYS_FORMAT_VERSION ||
+        type != static_cast<uint32_t>(stored.type) || num_gates != stored.shape.num_gates ||
+        digest != stored.shape.digest) {
+        return false;
+    }
+
+    uint64_t vk_size = 0;
+    read(is, vk_size);
+    auto const vk_offset = static_cast<std::streamoff>(is.tellg());
+    if (!is.good() || vk_offset < 0 || vk_size > keys_size - static_cast<uint64_t>(vk_offset)) {
+        return false;
+    }
+    std::vector<uint8_t> vk_buf(vk_size);
+    is.read(reinterpret_cast<char*>(vk_buf.data()), static_cast<std::streamsize>(vk_size));
+    if (!is.good()) {
+        return false;
+    }
+    auto const crs_factory = get_crs_factory();
+    NT::VKData vk_data;
+    uint8_t const* vk_it = vk_buf.data();
+    read(vk_it, vk_data);
+    if (vk_it != vk_buf.data() + vk_buf.size()) {
+        return false;
+    }
+    stored.keys.verification_key =
+        std::make_shared<plonk::verification_key>(std::move(vk_data), crs_factory->get_verifier_crs());
+
+    plonk::proving_key_data pk_data;
+    plonk::read_mmap(is, circuit_dir, pk_data);
+    if (!is) {
+        return false;
+    }
+    auto prover_crs = crs_factory->get_prover_crs(pk_data.circuit_size + 1);
+    stored.keys.proving_key = std::make_shared<plonk::proving_key>(std::move(pk_data), prover_crs);
+    return true;
+}
+#endif
+
+}  // namespace
+
+CircuitShape get_circuit_shape(plonk::UltraComposer& composer)
+{
+    // the circuit is only final once the ROM/RAM and range list gates are added
+    composer.finalize_circuit();
+
+    Digest digest;
+    for (auto const& selector : composer.selectors) {
+        digest.add(selector);
+    }
+    // the wiring, through the variables that copy constraints merged
+    for (auto const* wire : { &composer.w_l, &composer.w_r, &composer.w_o, &composer.w_4 }) {
+        digest.add(static_cast<uint64_t>(wire->size()));
+        for (auto const variable_index : *wire) {
+            digest.add(composer.real_variable_index[variable_index]);
+        }
+    }
+    digest.add(composer.real_variable_tags);
+    for (auto const& [tag, tau] : composer.tau) {
+        digest.add(tag);
+        digest.add(tau);
+    }
+    for (auto const variable_index : composer.public_inputs) {
+        digest.add(composer.real_variable_index[variable_index]);
+    }
+    // lookup gates refer to tables by their position in this list
+    for (auto const& table : composer.lookup_tables) {
+        digest.add(static_cast<uint64_t>(table.id));
+    }
+
+    return { .num_gates = composer.get_num_gates(), .digest = digest.value() };
+}
+
+std::shared_ptr<proof_system::ReferenceStringFactory> get_crs_factory()
+{
+    static auto const crs_factory =
+        std::make_shared<SharedReferenceStringFactory>(std::make_shared<proof_system::EnvReferenceStringFactory>());
+    return crs_factory;
+}
+
+CircuitKeys const& get_circuit_keys(CircuitType type, plonk::UltraComposer& composer)
+{
+    return get_cache_entry(type, composer).keys;
+}
+
+NT::Proof prove_with_cached_keys(CircuitType type, plonk::UltraComposer& composer)
+{
+    [[maybe_unused]] auto& entry = get_cache_entry(type, composer);
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> const lock(entry.proving_mutex);
+#endif
+    auto prover = composer.create_prover();
+    return prover.construct_proof();
+}
+
+bool write_cached_keys(std::string const& dir)
+{
+#ifdef __wasm__
+    (void)dir;
+    return false;
+#else
+    using serialize::write;
+
+    auto const cached_keys = get_cached_keys();
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    std::ofstream index(dir + "/index", std::ios::binary);
+    if (error || !index) {
+        return false;
+    }
+
+    write(index, CACHED_KEYS_FORMAT_VERSION);
+    write(index, static_cast<uint32_t>(cached_keys.size()));
+    bool all_written = true;
+    for (auto const& stored : cached_keys) {
+        uint64_t content_digest = 0;
+        all_written = write_circuit_keys(dir, stored, content_digest) && all_written;
+        write(index, static_cast<uint32_t>(stored.type));
+        write(index, static_cast<uint64_t>(stored.shape.num_gates));
+        write(index, stored.shape.digest);
+        write(index, content_digest);
+    }
+    return index.good() && all_written;
+#endif
+}
+
+std::vector<StoredCircuitKeys> read_cached_keys(std::string const& dir)
+{
+    std::vector<StoredCircuitKeys> stored_keys;
+#ifdef __wasm__
+    (void)dir;
+#else
+    using serialize::read;
+
+    std::ifstream index(dir + "/index", std::ios::binary);
+    uint32_t version = 0;
+    uint32_t num_circuits = 0;
+    read(index, version);
+    read(index, num_circuits);
+    if (!index.good() || version != CACHED_KEYS_FORMAT_VERSION) {
+        return stored_keys;
+    }
+
+    for (uint32_t i = 0; i < num_circuits; i++) {
+        uint32_t type = 0;
+        uint64_t num_gates = 0;
+        uint64_t digest = 0;
+        uint64_t content_digest = 0;
+        read(index, type);
+        read(index, num_gates);
+        read(index, digest);
+        read(index, content_digest);
+        if (!index.good()) {
+            break;
+        }
+        StoredCircuitKeys stored = { .type = static_cast<CircuitType>(type),
+                                     .shape = { .num_gates = num_gates, .digest = digest },
+                                     .keys = {} };
+        if (read_circuit_keys(dir, stored, content_digest)) {
+            stored_keys.push_back(std::move(stored));
+        }
+    }
+#endif
+    return stored_keys;
+}
+
+size_t load_cached_keys(std::string const& dir)
+{
+    auto stored_keys = read_cached_keys(dir);
+
+    size_t num_loaded = 0;
+    for (auto& stored : stored_keys) {
+        auto& entry = find_or_insert_entry(stored.type, stored.shape);
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(entry.keys_mutex);
+#endif
+        if (!entry.keys.proving_key) {
+            entry.keys = std::move(stored.keys);
+            num_loaded++;
+        }
+    }
+    return num_loaded;
+}
+
+}  // namespace aztec3::circuits::kernel
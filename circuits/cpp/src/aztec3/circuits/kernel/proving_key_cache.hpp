@@ -0,0 +1,119 @@
+#pragma once
+
+#include "aztec3/utils/types/circuit_types.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/srs/reference_string/env_reference_string.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aztec3::circuits::kernel {
+
+using NT = aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief The circuits whose proving and verification keys are cached, see `get_circuit_keys`
+ */
+enum class CircuitType : uint8_t {
+    PRIVATE_KERNEL_FIRST_ITERATION = 0,
+    PRIVATE_KERNEL_INNER = 1,
+    MOCK_KERNEL = 2,
+};
+
+/**
+ * @brief The structure of a finalised circuit, which its keys are computed from
+ *
+ * @details Circuits of the same type can differ by more than their size (e.g. the private kernel verifies private
+ * calls whose verification keys differ), so keys are only shared between circuits of the same type and shape.
+ */
+struct CircuitShape {
+    size_t num_gates = 0;
+    // digest of the selectors, the wiring (copy constraints and tags), the public inputs and the lookup tables
+    uint64_t digest = 0;
+
+    auto operator<=>(CircuitShape const&) const = default;
+};
+
+struct CircuitKeys {
+    std::shared_ptr<plonk::proving_key> proving_key;
+    std::shared_ptr<plonk::verification_key> verification_key;
+};
+
+/**
+ * @brief Keys read from disk, with the circuit they were cached for, see `read_cached_keys`
+ */
+struct StoredCircuitKeys {
+    CircuitType type;
+    CircuitShape shape;
+    CircuitKeys keys;
+};
+
+/**
+ * @brief Version of the on-disk format written by `write_cached_keys`, bumped on every change to it
+ */
+constexpr uint32_t CACHED_KEYS_FORMAT_VERSION = 3;
+
+/**
+ * @brief The reference string factory shared by every circuit proved in this process
+ */
+std::shared_ptr<proof_system::ReferenceStringFactory> get_crs_factory();
+
+/**
+ * @brief Finalise the circuit built in `composer` and compute its shape
+ */
+CircuitShape get_circuit_shape(plonk::UltraComposer& composer);
+
+/**
+ * @brief Get the keys of the circuit built in `composer`, computing them only the first time a circuit of this type
+ * and shape is seen by the process
+ *
+ * @details The circuit is finalised first (its shape is only known then). If the keys are already cached, they are
+ * given to the composer so that proving it only computes the witness polynomials. Keys of different circuits are
+ * computed concurrently.
+ *
+ * @param type The circuit built in `composer`
+ * @param composer A composer holding the whole circuit, created with the factory from `get_crs_factory()`
+ * @return CircuitKeys const& The cached keys, valid for the lifetime of the process
+ */
+CircuitKeys const& get_circuit_keys(CircuitType type, plonk::UltraComposer& composer);
+
+/**
+ * @brief Prove the circuit built in `composer`, with keys from `get_circuit_keys`
+ *
+ * @details The prover writes the witness polynomials into the proving key, so proofs of circuits sharing cached keys
+ * are constructed one at a time.
+ */
+NT::Proof prove_with_cached_keys(CircuitType type, plonk::UltraComposer& composer);
+
+/**
+ * @brief Write every key cached by this process to `dir`, for other processes to load with `load_cached_keys`
+ *
+ * @details `dir` gets an `index` file listing the cached circuits and a directory per circuit. That directory holds a
+ * `keys` file (a header with the format version and the circuit, the verification key and the proving key metadata)
+ * and one file per precomputed polynomial of the proving key, which are memory-mapped when loaded. The index holds the
+ * digest of the files of each circuit, checked before they are loaded.
+ *
+ * @return bool Whether every key was written (never in wasm, which has no file system to write to)
+ */
+bool write_cached_keys(std::string const& dir);
+
+/**
+ * @brief Read the keys written by `write_cached_keys` to `dir`, memory-mapping their polynomials
+ *
+ * @details The keys of a circuit written with another format version, whose files don't match their digest, or that
+ * can't be read, are skipped.
+ */
+std::vector<StoredCircuitKeys> read_cached_keys(std::string const& dir);
+
+/**
+ * @brief Add the keys written to `dir` to the cache, so that proving these circuits skips computing their keys
+ *
+ * @return size_t The number of circuits whose keys were added (circuits already cached keep their keys)
+ */
+size_t load_cached_keys(std::string const& dir);
+
+}  // namespace aztec3::circuits::kernel
@@ -0,0 +1,138 @@
+#include "init.hpp"
+#include "native_public_kernel_circuit_private_previous_kernel.hpp"
+#include "native_public_kernel_circuit_public_previous_kernel.hpp"
+#include "native_public_kernel_tx.hpp"
+
+#include "aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp"
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/types/fixed_base_pedersen.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// BENCHMARK_MAIN is in private/.bench.cpp: the benchmarks of the kernel module are linked into one binary
+
+namespace aztec3::circuits::kernel::public_kernel {
+
+namespace {
+
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
+using aztec3::circuits::abis::public_kernel::PublicKernelInputs;
+
+#ifdef COUNT_PEDERSEN_COMPRESSIONS
+using aztec3::utils::types::fixed_base_pedersen::num_compressions;
+
+size_t get_num_compressions()
+{
+    return num_compressions.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Report the Pedersen compressions per transaction, in builds configured with COUNT_PEDERSEN_COMPRESSIONS
+ */
+void report_compressions(benchmark::State& state, size_t start_compressions)
+{
+    auto const compressions = get_num_compressions() - start_compressions;
+    state.counters["pedersen_compressions"] =
+        benchmark::Counter(static_cast<double>(compressions), benchmark::Counter::kAvgIterations);
+}
+#else
+size_t get_num_compressions()
+{
+    return 0;
+}
+
+void report_compressions(benchmark::State& /*unused*/, size_t /*unused*/) {}
+#endif
+
+/**
+ * @brief A transaction whose public call has a full call stack of calls to other contracts, each calling nothing
+ */
+struct PublicTx {
+    PreviousKernelData<NT> previous_kernel;
+    // in the order the kernel pops them from the public call stack
+    std::vector<PublicCallData<NT>> public_calls;
+};
+
+PublicCallData<NT> public_call(NT::fr contract_address, NT::fr msg_sender, uint32_t function_selector)
+{
+    PublicCallData<NT> call;
+    call.call_stack_item.contract_address = contract_address;
+    call.call_stack_item.function_data.function_selector = function_selector;
+    call.call_stack_item.public_inputs.call_context.msg_sender = msg_sender;
+    call.call_stack_item.public_inputs.call_context.storage_contract_address = contract_address;
+    call.call_stack_item.public_inputs.args[0] = NT::fr(function_selector);
+    call.bytecode_hash = NT::fr(function_selector);
+    return call;
+}
+
+PublicTx public_tx_with_full_call_stack()
+{
+    NT::fr const contract_address = 1000;
+    auto first_call = public_call(contract_address, NT::fr(999), 1);
+    std::vector<PublicCallData<NT>> children;
+    for (size_t i = 0; i < PUBLIC_CALL_STACK_LENGTH; i++) {
+        auto child = public_call(NT::fr(1001 + i), contract_address, static_cast<uint32_t>(i + 2));
+        first_call.public_call_stack_preimages[i] = child.call_stack_item;
+        first_call.call_stack_item.public_inputs.public_call_stack[i] = child.call_stack_item.hash();
+        children.push_back(child);
+    }
+
+    PublicTx tx;
+    tx.previous_kernel.public_inputs.is_private = true;
+    tx.previous_kernel.public_inputs.end.public_call_stack[0] = first_call.call_stack_item.hash();
+    tx.public_calls.push_back(first_call);
+    // the last child pushed is popped first
+    tx.public_calls.insert(tx.public_calls.end(), children.rbegin(), children.rend());
+    return tx;
+}
+
+/**
+ * @brief The public kernel iterations of a transaction simulated one by one, as with one `public_kernel__sim` per
+ * call: a call is hashed as a preimage by the iteration of its caller, and again by its own
+ */
+void native_public_kernel_separate_iterations(benchmark::State& state)
+{
+    auto const tx = public_tx_with_full_call_stack();
+
+    auto const start_compressions = get_num_compressions();
+    for (auto _ : state) {
+        PublicKernelInputs<NT> inputs = { .previous_kernel = tx.previous_kernel };
+        for (auto const& call : tx.public_calls) {
+            DummyComposer composer = DummyComposer("public_kernel_bench__native_public_kernel_separate_iterations");
+            inputs.public_call = call;
+            inputs.previous_kernel.public_inputs =
+                inputs.previous_kernel.public_inputs.is_private
+                    ? native_public_kernel_circuit_private_previous_kernel(composer, inputs)
+                    : native_public_kernel_circuit_public_previous_kernel(composer, inputs);
+        }
+        benchmark::DoNotOptimize(inputs.previous_kernel.public_inputs);
+    }
+    report_compressions(state, start_compressions);
+}
+BENCHMARK(native_public_kernel_separate_iterations);
+
+/**
+ * @brief The same iterations in one `native_public_kernel_tx`, which hashes each call once
+ */
+void native_public_kernel_tx_iterations(benchmark::State& state)
+{
+    auto const tx = public_tx_with_full_call_stack();
+
+    auto const start_compressions = get_num_compressions();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(native_public_kernel_tx(
+            "public_kernel_bench__native_public_kernel_tx_iterations", tx.previous_kernel, tx.public_calls));
+    }
+    report_compressions(state, start_compressions);
+}
+BENCHMARK(native_public_kernel_tx_iterations);
+
+}  // namespace
+
+}  // namespace aztec3::circuits::kernel::public_kernel
@@ -2,6 +2,7 @@
 #include "native_public_kernel_circuit_no_previous_kernel.hpp"
 #include "native_public_kernel_circuit_private_previous_kernel.hpp"
 #include "native_public_kernel_circuit_public_previous_kernel.hpp"
+#include "native_public_kernel_tx.hpp"
 
 #include "aztec3/circuits/abis/combined_historic_tree_roots.hpp"
 #include <aztec3/circuits/abis/call_context.hpp>
@@ -691,6 +692,26 @@ TEST(public_kernel_tests, inconsistent_call_hash_should_fail)
     }
 }
 
+TEST(public_kernel_tests, fail_fast_stops_at_first_failure)
+{
+    PublicKernelInputsNoPreviousKernel<NT> inputs = get_kernel_inputs_no_previous_kernel();
+    // change two entries of the call stack pre-image so that each of them fails
+    inputs.public_call.public_call_stack_preimages[0].public_inputs.args[0]++;
+    inputs.public_call.public_call_stack_preimages[1].public_inputs.args[0]++;
+
+    DummyComposer dummyComposer = DummyComposer("public_kernel_tests__fail_fast_stops_at_first_failure");
+    native_public_kernel_circuit_no_previous_kernel(dummyComposer, inputs);
+    ASSERT_GT(dummyComposer.failure_msgs.size(), static_cast<size_t>(1));
+
+    DummyComposer failFastComposer =
+        DummyComposer("public_kernel_tests__fail_fast_stops_at_first_failure-fail_fast", true);
+    native_public_kernel_circuit_no_previous_kernel(failFastComposer, inputs);
+    ASSERT_TRUE(failFastComposer.should_stop());
+    ASSERT_EQ(failFastComposer.failure_msgs.size(), static_cast<size_t>(1));
+    ASSERT_EQ(failFastComposer.get_first_failure().code, dummyComposer.get_first_failure().code);
+    ASSERT_EQ(failFastComposer.get_first_failure().message, dummyComposer.get_first_failure().message);
+}
+
 TEST(public_kernel_tests, incorrect_storage_contract_address_fails_for_regular_calls)
 {
     for (size_t i = 0; i < PUBLIC_CALL_STACK_LENGTH; i++) {
@@ -1124,4 +1145,88 @@ TEST(public_kernel_tests, previous_public_kernel_fails_if_incorrect_storage_cont
     ASSERT_EQ(dummyComposer.get_first_failure().code,
               CircuitErrorCode::PUBLIC_KERNEL__CALL_CONTEXT_INVALID_STORAGE_ADDRESS_FOR_DELEGATE_CALL);
 }
-}  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
+
+TEST(public_kernel_tests, native_public_kernel_tx_matches_separate_iterations)
+{
+    PublicKernelInputs<NT> inputs = get_kernel_inputs_with_previous_kernel(true);
+
+    // the first call's last child is the second call: it calls nothing, and has no storage reads or writes so that
+    // the accumulated ones fit
+    auto& child = inputs.public_call.public_call_stack_preimages[PUBLIC_CALL_STACK_LENGTH - 1];
+    child.public_inputs.public_call_stack = zero_array<NT::fr, PUBLIC_CALL_STACK_LENGTH>();
+    child.public_inputs.contract_storage_reads = {};
+    child.public_inputs.contract_storage_update_requests = {};
+    inputs.public_call.call_stack_item.public_inputs.public_call_stack[PUBLIC_CALL_STACK_LENGTH - 1] = child.hash();
+    inputs.previous_kernel.public_inputs.end.public_call_stack[0] = inputs.public_call.call_stack_item.hash();
+    PublicCallData<NT> second_call = {
+        .call_stack_item = child,
+        .portal_contract_address = child.public_inputs.call_context.portal_contract_address,
+        .bytecode_hash = 7654321,
+    };
+
+    DummyComposer first_composer = DummyComposer("public_kernel_tests__native_public_kernel_tx_first_iteration");
+    auto const first_public_inputs = native_public_kernel_circuit_private_previous_kernel(first_composer, inputs);
+    ASSERT_FALSE(first_composer.failed());
+    DummyComposer second_composer = DummyComposer("public_kernel_tests__native_public_kernel_tx_second_iteration");
+    PublicKernelInputs<NT> second_inputs = { .previous_kernel = inputs.previous_kernel, .public_call = second_call };
+    second_inputs.previous_kernel.public_inputs = first_public_inputs;
+    auto const second_public_inputs =
+        native_public_kernel_circuit_public_previous_kernel(second_composer, second_inputs);
+    ASSERT_FALSE(second_composer.failed());
+
+    auto const result =
+        native_public_kernel_tx("public_kernel_tests__native_public_kernel_tx_matches_separate_iterations",
+                                inputs.previous_kernel,
+                                { inputs.public_call, second_call });
+    ASSERT_EQ(result.public_inputs, second_public_inputs);
+    ASSERT_EQ(result.failures.size(), 2U);
+    for (auto const& failure : result.failures) {
+        ASSERT_EQ(failure.code, CircuitErrorCode::NO_ERROR);
+    }
+
+    // the iterations stop at the first failing one
+    second_call.bytecode_hash = 0;
+    auto const failing_result =
+        native_public_kernel_tx("public_kernel_tests__native_public_kernel_tx_stops_at_failing_iteration",
+                                inputs.previous_kernel,
+                                { inputs.public_call, second_call, second_call });
+    ASSERT_EQ(failing_result.failures.size(), 2U);
+    ASSERT_EQ(failing_result.failures[0].code, CircuitErrorCode::NO_ERROR);
+    ASSERT_EQ(failing_result.failures[1].code, CircuitErrorCode::PUBLIC_KERNEL__BYTECODE_HASH_INVALID);
+}
+
+TEST(public_kernel_tests, native_public_kernel_iterations_hash_a_validated_preimage_once)
+{
+    PublicKernelInputs<NT> inputs = get_kernel_inputs_with_previous_kernel(true);
+
+    // the second call is the last child of the first one, as in native_public_kernel_tx_matches_separate_iterations
+    auto& child = inputs.public_call.public_call_stack_preimages[PUBLIC_CALL_STACK_LENGTH - 1];
+    child.public_inputs.public_call_stack = zero_array<NT::fr, PUBLIC_CALL_STACK_LENGTH>();
+    child.public_inputs.contract_storage_reads = {};
+    child.public_inputs.contract_storage_update_requests = {};
+    inputs.public_call.call_stack_item.public_inputs.public_call_stack[PUBLIC_CALL_STACK_LENGTH - 1] = child.hash();
+    inputs.previous_kernel.public_inputs.end.public_call_stack[0] = inputs.public_call.call_stack_item.hash();
+
+    CallStackItemHashes call_stack_item_hashes(2 * KERNEL_PUBLIC_CALL_STACK_LENGTH);
+    DummyComposer composer = DummyComposer("public_kernel_tests__native_public_kernel_iterations_hash_once");
+    PublicKernelInputs<NT> second_inputs = {
+        .previous_kernel = inputs.previous_kernel,
+        .public_call = { .call_stack_item = child,
+                         .portal_contract_address = child.public_inputs.call_context.portal_contract_address,
+                         .bytecode_hash = 7654321 },
+    };
+    second_inputs.previous_kernel.public_inputs =
+        native_public_kernel_circuit_private_previous_kernel(composer, inputs, call_stack_item_hashes);
+    ASSERT_EQ(call_stack_item_hashes.get_num_hits(), 0U);
+    auto const second_public_inputs =
+        native_public_kernel_circuit_public_previous_kernel(composer, second_inputs, call_stack_item_hashes);
+    ASSERT_FALSE(composer.failed());
+    // the call of the second iteration was hashed as a preimage by the first one
+    ASSERT_EQ(call_stack_item_hashes.get_num_hits(), 1U);
+
+    DummyComposer separate_composer = DummyComposer("public_kernel_tests__native_public_kernel_iterations_separate");
+    ASSERT_EQ(second_public_inputs,
+              native_public_kernel_circuit_public_previous_kernel(separate_composer, second_inputs));
+    ASSERT_FALSE(separate_composer.failed());
+}
+}  // namespace aztec3::circuits::kernel::public_kernel
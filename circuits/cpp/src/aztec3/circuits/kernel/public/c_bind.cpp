@@ -4,7 +4,10 @@
 #include "init.hpp"
 
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/sim_batch.hpp"
 #include <aztec3/circuits/abis/kernel_circuit_public_inputs.hpp>
+#include <aztec3/circuits/abis/previous_kernel_data.hpp>
+#include <aztec3/circuits/abis/public_kernel/public_call_data.hpp>
 #include <aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp>
 #include <aztec3/circuits/abis/public_kernel/public_kernel_inputs_no_previous_kernel.hpp>
 #include <aztec3/constants.hpp>
@@ -14,16 +17,24 @@
 #include <barretenberg/serialize/cbind.hpp>
 #include <barretenberg/srs/reference_string/env_reference_string.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace {
 using Composer = plonk::UltraComposer;
 using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
+using aztec3::utils::CircuitResult;
+using aztec3::utils::simulate_batch;
 using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
 using aztec3::circuits::abis::public_kernel::PublicKernelInputs;
 using aztec3::circuits::abis::public_kernel::PublicKernelInputsNoPreviousKernel;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_no_previous_kernel;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_private_previous_kernel;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_public_previous_kernel;
+using aztec3::circuits::kernel::public_kernel::native_public_kernel_tx;
 }  // namespace
 
 // WASM Cbinds
@@ -52,20 +63,38 @@ WASM_EXPORT size_t public_kernel__init_verification_key(uint8_t const* pk_buf, u
     return vk_vec.size();
 }
 
-CBIND(public_kernel__sim, [](PublicKernelInputs<NT> public_kernel_inputs) {
-    DummyComposer composer = DummyComposer("public_kernel__sim");
+namespace {
+/**
+ * @brief Simulate the public kernel with a previous kernel, see `public_kernel__sim`
+ *
+ * @param fail_fast Whether the simulation stops at the first failure (the only one reported) rather than running to
+ * completion
+ */
+CircuitResult<KernelCircuitPublicInputs<NT>> simulate_public_kernel(std::string const& method_name,
+                                                                    bool fail_fast,
+                                                                    PublicKernelInputs<NT> const& public_kernel_inputs)
+{
+    DummyComposer composer = DummyComposer(method_name, fail_fast);
     KernelCircuitPublicInputs<NT> const result =
         public_kernel_inputs.previous_kernel.public_inputs.is_private
             ? native_public_kernel_circuit_private_previous_kernel(composer, public_kernel_inputs)
             : native_public_kernel_circuit_public_previous_kernel(composer, public_kernel_inputs);
     return composer.result_or_error(result);
-});
+}
 
-WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim(uint8_t const* public_kernel_inputs_buf,
-                                                           size_t* public_kernel_public_inputs_size_out,
-                                                           uint8_t const** public_kernel_public_inputs_buf)
+/**
+ * @brief Simulate the public kernel without a previous kernel, see `public_kernel_no_previous_kernel__sim`
+ *
+ * @param fail_fast Whether the simulation stops at the first failure (the only one reported) rather than running to
+ * completion
+ */
+uint8_t* simulate_public_kernel_no_previous_kernel(std::string const& method_name,
+                                                   bool fail_fast,
+                                                   uint8_t const* public_kernel_inputs_buf,
+                                                   size_t* public_kernel_public_inputs_size_out,
+                                                   uint8_t const** public_kernel_public_inputs_buf)
 {
-    DummyComposer composer = DummyComposer("public_kernel_no_previous_kernel__sim");
+    DummyComposer composer = DummyComposer(method_name, fail_fast);
 
     PublicKernelInputsNoPreviousKernel<NT> public_kernel_inputs;
     read(public_kernel_inputs_buf, public_kernel_inputs);
@@ -83,3 +112,62 @@ WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim(uint8_t const* public
     *public_kernel_public_inputs_size_out = public_inputs_vec.size();
     return composer.alloc_and_serialize_first_failure();
 }
+}  // namespace
+
+CBIND(public_kernel__sim, [](PublicKernelInputs<NT> public_kernel_inputs) {
+    return simulate_public_kernel("public_kernel__sim", false, public_kernel_inputs);
+});
+
+// Same as public_kernel__sim, but stops at the first failure. Use it to cheaply reject invalid transactions.
+CBIND(public_kernel__sim_fail_fast, [](PublicKernelInputs<NT> public_kernel_inputs) {
+    return simulate_public_kernel("public_kernel__sim_fail_fast", true, public_kernel_inputs);
+});
+
+// Simulates each public kernel iteration of `public_kernel_inputs`, in parallel on native builds. Returns the public
+// inputs and first failure of each (SimBatchResult).
+CBIND(public_kernel__sim_batch, [](std::vector<PublicKernelInputs<NT>> public_kernel_inputs) {
+    return simulate_batch("public_kernel__sim_batch",
+                          public_kernel_inputs,
+                          [](DummyComposer& composer, PublicKernelInputs<NT> const& inputs) {
+                              return inputs.previous_kernel.public_inputs.is_private
+                                         ? native_public_kernel_circuit_private_previous_kernel(composer, inputs)
+                                         : native_public_kernel_circuit_public_previous_kernel(composer, inputs);
+                          });
+});
+
+// Simulates the public kernel iterations of every public call of a transaction in one go, rather than one
+// public_kernel__sim per call, see native_public_kernel_tx. Returns the public inputs of the last iteration run, and
+// the first failure of each iteration.
+CBIND(public_kernel__sim_tx, [](PreviousKernelData<NT> previous_kernel, std::vector<PublicCallData<NT>> public_calls) {
+    return native_public_kernel_tx("public_kernel__sim_tx", std::move(previous_kernel), std::move(public_calls));
+});
+
+// Same as public_kernel__sim_tx, but each iteration stops at its first failure.
+CBIND(public_kernel__sim_tx_fail_fast,
+      [](PreviousKernelData<NT> previous_kernel, std::vector<PublicCallData<NT>> public_calls) {
+          return native_public_kernel_tx(
+              "public_kernel__sim_tx_fail_fast", std::move(previous_kernel), std::move(public_calls), true);
+      });
+
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim(uint8_t const* public_kernel_inputs_buf,
+                                                           size_t* public_kernel_public_inputs_size_out,
+                                                           uint8_t const** public_kernel_public_inputs_buf)
+{
+    return simulate_public_kernel_no_previous_kernel("public_kernel_no_previous_kernel__sim",
+                                                     false,
+                                                     public_kernel_inputs_buf,
+                                                     public_kernel_public_inputs_size_out,
+                                                     public_kernel_public_inputs_buf);
+}
+
+// Same as public_kernel_no_previous_kernel__sim, but stops at the first failure.
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim_fail_fast(uint8_t const* public_kernel_inputs_buf,
+                                                                     size_t* public_kernel_public_inputs_size_out,
+                                                                     uint8_t const** public_kernel_public_inputs_buf)
+{
+    return simulate_public_kernel_no_previous_kernel("public_kernel_no_previous_kernel__sim_fail_fast",
+                                                     true,
+                                                     public_kernel_inputs_buf,
+                                                     public_kernel_public_inputs_size_out,
+                                                     public_kernel_public_inputs_buf);
+}
@@ -38,7 +38,8 @@ void common_initialise_end_values(PublicKernelInputs<NT> const& public_kernel_in
  */
 void validate_this_public_call_hash(DummyComposer& composer,
                                     PublicKernelInputs<NT> const& public_kernel_inputs,
-                                    KernelCircuitPublicInputs<NT>& public_inputs)
+                                    KernelCircuitPublicInputs<NT>& public_inputs,
+                                    CallStackItemHashes& call_stack_item_hashes)
 {
     // If public call stack is empty, we bail so array_pop doesn't throw_or_abort
     if (array_length(public_inputs.end.public_call_stack) == 0) {
@@ -53,15 +54,17 @@ void validate_this_public_call_hash(DummyComposer& composer,
     // and the 'gas rebate' tx).
     const auto popped_public_call_hash = array_pop(public_inputs.end.public_call_stack);
     const auto calculated_this_public_call_hash =
-        get_call_stack_item_hash(public_kernel_inputs.public_call.call_stack_item);
+        get_call_stack_item_hash(public_kernel_inputs.public_call.call_stack_item, call_stack_item_hashes);
 
     composer.do_assert(
         popped_public_call_hash == calculated_this_public_call_hash,
-        format("calculated public_call_hash (",
-               calculated_this_public_call_hash,
-               ") does not match provided public_call_hash (",
-               popped_public_call_hash,
-               ") at the top of the call stack"),
+        [&] {
+            return format("calculated public_call_hash (",
+                          calculated_this_public_call_hash,
+                          ") does not match provided public_call_hash (",
+                          popped_public_call_hash,
+                          ") at the top of the call stack");
+        },
         CircuitErrorCode::PUBLIC_KERNEL__CALCULATED_PRIVATE_CALL_HASH_AND_PROVIDED_PRIVATE_CALL_HASH_MISMATCH);
 };
 }  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
@@ -2,9 +2,11 @@
 
 #include "init.hpp"
 
+#include <aztec3/circuits/abis/call_stack_item.hpp>
 #include <aztec3/circuits/abis/contract_storage_read.hpp>
 #include <aztec3/circuits/abis/contract_storage_update_request.hpp>
 #include <aztec3/circuits/abis/kernel_circuit_public_inputs.hpp>
+#include <aztec3/circuits/abis/hash_memo.hpp>
 #include <aztec3/circuits/abis/public_data_update_request.hpp>
 #include <aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp>
 #include <aztec3/circuits/abis/public_kernel/public_kernel_inputs_no_previous_kernel.hpp>
@@ -32,14 +34,21 @@ using aztec3::utils::push_array_to_array;
 
 namespace aztec3::circuits::kernel::public_kernel {
 
+// The hashes of the public call stack items hashed by the iterations of a transaction, see `abis::HashMemo`
+using CallStackItemHashes = aztec3::circuits::abis::HashMemo<abis::CallStackItem<NT, abis::PublicTypes>>;
+
 /**
  * @brief Validate that all pre-images on the call stack hash to equal the accumulated data
  * @tparam The type of kernel input
  * @param composer The circuit composer
  * @param public_kernel_inputs The inputs to this iteration of the kernel circuit
+ * @param call_stack_item_hashes The hashes of the call stack items hashed so far, where the pre-images are memoised
+ * for the iterations that execute them
  */
 template <typename KernelInput>
-void common_validate_call_stack(DummyComposer& composer, KernelInput const& public_kernel_inputs)
+void common_validate_call_stack(DummyComposer& composer,
+                                KernelInput const& public_kernel_inputs,
+                                CallStackItemHashes& call_stack_item_hashes)
 {
     // Ensures that the stack of pre-images corresponds to the call stack
     auto& stack = public_kernel_inputs.public_call.call_stack_item.public_inputs.public_call_stack;
@@ -63,16 +72,26 @@ void common_validate_call_stack(DummyComposer& composer, KernelInput const& publ
         if (hash == 0) {
             continue;
         }
+        // don't hash the remaining preimages once a fail-fast composer has failed
+        if (composer.should_stop()) {
+            return;
+        }
 
         const auto is_delegate_call = preimage.public_inputs.call_context.is_delegate_call;
         const auto is_static_call = preimage.public_inputs.call_context.is_static_call;
         const auto contract_being_called = preimage.contract_address;
 
-        const auto calculated_hash = preimage.hash();
+        const auto calculated_hash = call_stack_item_hashes.hash(preimage);
         composer.do_assert(
             hash == calculated_hash,
-            format(
-                "public_call_stack[", i, "] = ", hash, "; does not reconcile with calculatedHash = ", calculated_hash),
+            [&] {
+                return format("public_call_stack[",
+                              i,
+                              "] = ",
+                              hash,
+                              "; does not reconcile with calculatedHash = ",
+                              calculated_hash);
+            },
             CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_MISMATCH);
 
         // here we validate the msg sender for each call on the stack
@@ -80,13 +99,15 @@ void common_validate_call_stack(DummyComposer& composer, KernelInput const& publ
         const auto preimage_msg_sender = preimage.public_inputs.call_context.msg_sender;
         const auto expected_msg_sender = is_delegate_call ? our_msg_sender : our_contract_address;
         composer.do_assert(expected_msg_sender == preimage_msg_sender,
-                           format("call_stack_msg_sender[",
-                                  i,
-                                  "] = ",
-                                  preimage_msg_sender,
-                                  " expected ",
-                                  expected_msg_sender,
-                                  "; does not reconcile"),
+                           [&] {
+                               return format("call_stack_msg_sender[",
+                                             i,
+                                             "] = ",
+                                             preimage_msg_sender,
+                                             " expected ",
+                                             expected_msg_sender,
+                                             "; does not reconcile");
+                           },
                            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_MSG_SENDER);
 
         // here we validate the storage address for each call on the stack
@@ -94,33 +115,37 @@ void common_validate_call_stack(DummyComposer& composer, KernelInput const& publ
         const auto preimage_storage_address = preimage.public_inputs.call_context.storage_contract_address;
         const auto expected_storage_address = is_delegate_call ? our_storage_address : contract_being_called;
         composer.do_assert(expected_storage_address == preimage_storage_address,
-                           format("call_stack_storage_address[",
-                                  i,
-                                  "] = ",
-                                  preimage_storage_address,
-                                  " expected ",
-                                  expected_storage_address,
-                                  "; does not reconcile"),
+                           [&] {
+                               return format("call_stack_storage_address[",
+                                             i,
+                                             "] = ",
+                                             preimage_storage_address,
+                                             " expected ",
+                                             expected_storage_address,
+                                             "; does not reconcile");
+                           },
                            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_STORAGE_ADDRESS);
 
         // if it is a delegate call then we check that the portal contract in the pre image is our portal contract
         const auto preimage_portal_address = preimage.public_inputs.call_context.portal_contract_address;
         const auto expected_portal_address = our_portal_contract_address;
         composer.do_assert(!is_delegate_call || expected_portal_address == preimage_portal_address,
-                           format("call_stack_portal_address[",
-                                  i,
-                                  "] = ",
-                                  preimage_portal_address,
-                                  " expected ",
-                                  expected_portal_address,
-                                  "; does not reconcile"),
+                           [&] {
+                               return format("call_stack_portal_address[",
+                                             i,
+                                             "] = ",
+                                             preimage_portal_address,
+                                             " expected ",
+                                             expected_portal_address,
+                                             "; does not reconcile");
+                           },
                            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_PORTAL_ADDRESS);
 
         const auto num_contract_storage_update_requests =
             array_length(preimage.public_inputs.contract_storage_update_requests);
         composer.do_assert(
             !is_static_call || num_contract_storage_update_requests == 0,
-            format("contract_storage_update_requests[", i, "] should be empty"),
+            [&] { return format("contract_storage_update_requests[", i, "] should be empty"); },
             CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_CONTRACT_STORAGE_UPDATES_PROHIBITED_FOR_STATIC_CALL);
     }
 };
@@ -143,12 +168,12 @@ void common_validate_call_context(DummyComposer& composer, KernelInput const& pu
         array_length(call_stack_item.public_inputs.contract_storage_update_requests);
 
     composer.do_assert(!is_delegate_call || contract_address != storage_contract_address,
-                       std::string("call_context contract_address == storage_contract_address on delegate_call"),
+                       "call_context contract_address == storage_contract_address on delegate_call",
                        CircuitErrorCode::PUBLIC_KERNEL__CALL_CONTEXT_INVALID_STORAGE_ADDRESS_FOR_DELEGATE_CALL);
 
     composer.do_assert(
         !is_static_call || contract_storage_update_requests_length == 0,
-        std::string("call_context contract storage update requests found on static call"),
+        "call_context contract storage update requests found on static call",
         CircuitErrorCode::PUBLIC_KERNEL__CALL_CONTEXT_CONTRACT_STORAGE_UPDATE_REQUESTS_PROHIBITED_FOR_STATIC_CALL);
 };
 
@@ -157,12 +182,15 @@ void common_validate_call_context(DummyComposer& composer, KernelInput const& pu
  * @tparam The type of kernel input
  * @param composer The circuit composer
  * @param public_kernel_inputs The inputs to this iteration of the kernel circuit
+ * @param call_stack_item_hashes The hashes of the call stack items hashed so far
  */
 template <typename KernelInput>
-void common_validate_kernel_execution(DummyComposer& composer, KernelInput const& public_kernel_inputs)
+void common_validate_kernel_execution(DummyComposer& composer,
+                                      KernelInput const& public_kernel_inputs,
+                                      CallStackItemHashes& call_stack_item_hashes)
 {
     common_validate_call_context(composer, public_kernel_inputs);
-    common_validate_call_stack(composer, public_kernel_inputs);
+    common_validate_call_stack(composer, public_kernel_inputs, call_stack_item_hashes);
 };
 
 /**
@@ -280,8 +308,11 @@ void common_initialise_end_values(PublicKernelInputs<NT> const& public_kernel_in
  * @param composer The circuit composer
  * @param public_kernel_inputs The inputs to this iteration of the kernel circuit
  * @param public_inputs The circuit outputs
+ * @param call_stack_item_hashes The hashes of the call stack items hashed so far, such as the pre-image of this call
+ * validated by the iteration of its caller
  */
 void validate_this_public_call_hash(DummyComposer& composer,
                                     PublicKernelInputs<NT> const& public_kernel_inputs,
-                                    KernelCircuitPublicInputs<NT>& public_inputs);
+                                    KernelCircuitPublicInputs<NT>& public_inputs,
+                                    CallStackItemHashes& call_stack_item_hashes);
 }  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
@@ -105,9 +105,17 @@ KernelCircuitPublicInputs<NT> native_public_kernel_circuit_no_previous_kernel(
 
     // validate the inputs unique to there being no previous kernel
     validate_inputs(composer, public_kernel_inputs);
-
-    // validate the kernel execution common to all invocation circumstances
-    common_validate_kernel_execution(composer, public_kernel_inputs);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
+    // validate the kernel execution common to all invocation circumstances (with no other iteration to share the hashes
+    // of call stack items with)
+    CallStackItemHashes call_stack_item_hashes(0);
+    common_validate_kernel_execution(composer, public_kernel_inputs, call_stack_item_hashes);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // update the public end state of the circuit
     update_public_end_values(composer, public_kernel_inputs, public_inputs);
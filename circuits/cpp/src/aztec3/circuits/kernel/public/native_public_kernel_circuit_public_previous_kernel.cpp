@@ -40,6 +40,16 @@ using DummyComposer = aztec3::utils::DummyComposer;
  */
 KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_previous_kernel(
     DummyComposer& composer, PublicKernelInputs<NT> const& public_kernel_inputs)
+{
+    // a single iteration has no other iteration to share hashes with
+    CallStackItemHashes call_stack_item_hashes(0);
+    return native_public_kernel_circuit_public_previous_kernel(composer, public_kernel_inputs, call_stack_item_hashes);
+}
+
+KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_previous_kernel(
+    DummyComposer& composer,
+    PublicKernelInputs<NT> const& public_kernel_inputs,
+    CallStackItemHashes& call_stack_item_hashes)
 {
     // construct the circuit outputs
     KernelCircuitPublicInputs<NT> public_inputs{};
@@ -52,12 +62,21 @@ KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_previous_kerne
 
     // validate the inputs unique to having a previous public kernel
     validate_inputs(composer, public_kernel_inputs);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // validate the kernel execution common to all invocation circumstances
-    common_validate_kernel_execution(composer, public_kernel_inputs);
+    common_validate_kernel_execution(composer, public_kernel_inputs, call_stack_item_hashes);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // validate our public call hash
-    validate_this_public_call_hash(composer, public_kernel_inputs, public_inputs);
+    validate_this_public_call_hash(composer, public_kernel_inputs, public_inputs, call_stack_item_hashes);
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // update the public end state of the circuit
     common_update_public_end_values(public_kernel_inputs, public_inputs);
@@ -15,4 +15,13 @@ using DummyComposer = aztec3::utils::DummyComposer;
 
 KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_previous_kernel(
     DummyComposer& composer, PublicKernelInputs<NT> const& public_kernel_inputs);
+
+/**
+ * @brief Same as `native_public_kernel_circuit_public_previous_kernel(composer, public_kernel_inputs)`, hashing
+ * the call stack items through `call_stack_item_hashes`, which the iterations of a transaction share
+ */
+KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_previous_kernel(
+    DummyComposer& composer,
+    PublicKernelInputs<NT> const& public_kernel_inputs,
+    CallStackItemHashes& call_stack_item_hashes);
 }  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
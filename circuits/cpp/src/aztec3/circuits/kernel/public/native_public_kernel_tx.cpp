@@ -0,0 +1,52 @@
+#include "native_public_kernel_tx.hpp"
+
+#include "native_public_kernel_circuit_private_previous_kernel.hpp"
+#include "native_public_kernel_circuit_public_previous_kernel.hpp"
+
+#include <aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp>
+#include <aztec3/constants.hpp>
+#include <aztec3/utils/dummy_composer.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace aztec3::circuits::kernel::public_kernel {
+
+using aztec3::circuits::abis::public_kernel::PublicKernelInputs;
+using DummyComposer = aztec3::utils::DummyComposer;
+
+namespace {
+// Enough for the pre-images of every call on the public call stack of the kernel, and the calls they were pushed by
+constexpr size_t CALL_STACK_ITEM_HASHES_CAPACITY = 2 * KERNEL_PUBLIC_CALL_STACK_LENGTH;
+}  // namespace
+
+PublicKernelTxResult native_public_kernel_tx(std::string const& method_name,
+                                             PreviousKernelData<NT> previous_kernel,
+                                             std::vector<PublicCallData<NT>> public_calls,
+                                             bool fail_fast)
+{
+    PublicKernelTxResult result{ .public_inputs = previous_kernel.public_inputs };
+    result.failures.reserve(public_calls.size());
+
+    // each call but the first is hashed as a pre-image by the iteration of its caller, then as the call of its own
+    CallStackItemHashes call_stack_item_hashes(CALL_STACK_ITEM_HASHES_CAPACITY);
+    PublicKernelInputs<NT> public_kernel_inputs = { .previous_kernel = std::move(previous_kernel) };
+    for (auto& public_call : public_calls) {
+        DummyComposer composer = DummyComposer(method_name, fail_fast);
+        public_kernel_inputs.previous_kernel.public_inputs = std::move(result.public_inputs);
+        public_kernel_inputs.public_call = std::move(public_call);
+        result.public_inputs =
+            public_kernel_inputs.previous_kernel.public_inputs.is_private
+                ? native_public_kernel_circuit_private_previous_kernel(
+                      composer, public_kernel_inputs, call_stack_item_hashes)
+                : native_public_kernel_circuit_public_previous_kernel(
+                      composer, public_kernel_inputs, call_stack_item_hashes);
+        result.failures.push_back(composer.get_first_failure());
+        if (composer.failed()) {
+            break;
+        }
+    }
+    return result;
+}
+
+}  // namespace aztec3::circuits::kernel::public_kernel
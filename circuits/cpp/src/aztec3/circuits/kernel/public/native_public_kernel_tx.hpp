@@ -0,0 +1,52 @@
+#pragma once
+
+#include "init.hpp"
+
+#include <aztec3/circuits/abis/kernel_circuit_public_inputs.hpp>
+#include <aztec3/circuits/abis/previous_kernel_data.hpp>
+#include <aztec3/circuits/abis/public_kernel/public_call_data.hpp>
+#include <aztec3/utils/circuit_errors.hpp>
+
+#include <barretenberg/serialize/msgpack.hpp>
+
+#include <string>
+#include <vector>
+
+namespace aztec3::circuits::kernel::public_kernel {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
+using aztec3::utils::CircuitError;
+
+/**
+ * @brief The outcome of the public kernel iterations of a transaction
+ */
+struct PublicKernelTxResult {
+    // the public inputs of the last iteration run
+    KernelCircuitPublicInputs<NT> public_inputs{};
+    // the first failure of each iteration run (`CircuitError::no_error()` if it passed), in the order of the calls
+    std::vector<CircuitError> failures;
+
+    // for serialization, update with new fields
+    MSGPACK_FIELDS(public_inputs, failures);
+};
+
+/**
+ * @brief Run the native public kernel over every public call of a transaction, each iteration taking the public inputs
+ * of the one before it
+ *
+ * @details The first iteration takes `previous_kernel` as is, and is the public kernel with a private or a public
+ * previous kernel depending on its `is_private`. The following ones take it with the public inputs accumulated so
+ * far: they simulate, they don't verify the proof of their previous kernel. The iterations stop after the first one
+ * that fails, as the public inputs it returns are not those of a valid call.
+ *
+ * @param public_calls The public calls of the transaction, in the order the kernel pops them from the public call stack
+ * @param fail_fast Whether each iteration stops at its first failure, see `DummyComposer::should_stop()`
+ */
+PublicKernelTxResult native_public_kernel_tx(std::string const& method_name,
+                                             PreviousKernelData<NT> previous_kernel,
+                                             std::vector<PublicCallData<NT>> public_calls,
+                                             bool fail_fast = false);
+
+}  // namespace aztec3::circuits::kernel::public_kernel
@@ -0,0 +1,142 @@
+#include "index.hpp"
+#include "init.hpp"
+
+#include "aztec3/circuits/rollup/test_utils/utils.hpp"
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+/**
+ * @brief Counts the heap allocations made by the current thread while it is in scope.
+ *
+ * @details The allocation functions below only forward to malloc and free, and only count while a counter is active
+ * on the allocating thread: allocations outside of the measured loops (the setup of the inputs, the benchmark
+ * library, other threads) are neither counted nor otherwise changed.
+ */
+class ScopedAllocationCounter {
+  public:
+    ScopedAllocationCounter() : previous(active) { active = this; }
+    ~ScopedAllocationCounter() { active = previous; }
+
+    ScopedAllocationCounter(ScopedAllocationCounter const&) = delete;
+    ScopedAllocationCounter(ScopedAllocationCounter&&) = delete;
+    ScopedAllocationCounter& operator=(ScopedAllocationCounter const&) = delete;
+    ScopedAllocationCounter& operator=(ScopedAllocationCounter&&) = delete;
+
+    static void count_allocation()
+    {
+        if (active != nullptr) {
+            active->num_allocations++;
+        }
+    }
+
+    size_t allocations() const { return num_allocations; }
+
+  private:
+    static thread_local ScopedAllocationCounter* active;  // NOLINT
+
+    ScopedAllocationCounter* previous;
+    size_t num_allocations = 0;
+};
+
+thread_local ScopedAllocationCounter* ScopedAllocationCounter::active = nullptr;  // NOLINT
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    ScopedAllocationCounter::count_allocation();
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*unused*/) noexcept
+{
+    std::free(ptr);
+}
+
+namespace aztec3::circuits::rollup::native_base_rollup {
+
+namespace {
+
+using aztec3::circuits::rollup::test_utils::utils::base_rollup_inputs_from_kernels;
+using aztec3::circuits::rollup::test_utils::utils::get_empty_kernel;
+
+void report_allocations(benchmark::State& state, ScopedAllocationCounter const& counter)
+{
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(counter.allocations()), benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * @brief A whole base rollup simulation where every check passes, reporting heap allocations per simulation
+ */
+void native_base_rollup_simulation(benchmark::State& state)
+{
+    auto const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    ScopedAllocationCounter const counter;
+    for (auto _ : state) {
+        DummyComposer composer = DummyComposer("base_rollup_bench__native_base_rollup_simulation");
+        benchmark::DoNotOptimize(base_rollup_circuit(composer, inputs));
+    }
+    report_allocations(state, counter);
+}
+BENCHMARK(native_base_rollup_simulation);
+
+/**
+ * @brief A passing assertion whose failure message is formatted from field elements before the check
+ */
+void passing_do_assert_eager_message(benchmark::State& state)
+{
+    DummyComposer composer = DummyComposer("base_rollup_bench__passing_do_assert_eager_message");
+    NT::fr const expected = NT::fr::random_element();
+    NT::fr const actual = expected;
+
+    ScopedAllocationCounter const counter;
+    for (auto _ : state) {
+        composer.do_assert(actual == expected,
+                           format("call_stack_msg_sender[0] = ", actual, " expected ", expected),
+                           CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_MSG_SENDER);
+    }
+    report_allocations(state, counter);
+}
+BENCHMARK(passing_do_assert_eager_message);
+
+/**
+ * @brief The same passing assertion, with a failure message only formatted if the check fails
+ */
+void passing_do_assert_lazy_message(benchmark::State& state)
+{
+    DummyComposer composer = DummyComposer("base_rollup_bench__passing_do_assert_lazy_message");
+    NT::fr const expected = NT::fr::random_element();
+    NT::fr const actual = expected;
+
+    ScopedAllocationCounter const counter;
+    for (auto _ : state) {
+        composer.do_assert(
+            actual == expected,
+            [&] { return format("call_stack_msg_sender[0] = ", actual, " expected ", expected); },
+            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_MSG_SENDER);
+    }
+    report_allocations(state, counter);
+}
+BENCHMARK(passing_do_assert_lazy_message);
+
+}  // namespace
+
+}  // namespace aztec3::circuits::rollup::native_base_rollup
+
+BENCHMARK_MAIN();
@@ -9,6 +9,7 @@
 #include "aztec3/circuits/abis/public_data_read.hpp"
 #include "aztec3/circuits/kernel/private/utils.hpp"
 #include "aztec3/circuits/rollup/components/components.hpp"
+#include "aztec3/circuits/rollup/merge/native_merge_rollup_circuit.hpp"
 #include "aztec3/circuits/rollup/test_utils/utils.hpp"
 #include "aztec3/constants.hpp"
 #include <aztec3/circuits/abis/call_context.hpp>
@@ -49,6 +50,9 @@
 namespace {
 
 
+using aztec3::circuits::compute_empty_sibling_path;
+using aztec3::circuits::get_empty_tree_root;
+using aztec3::circuits::abis::BaseRollupInputsView;
 using aztec3::circuits::abis::PreviousKernelData;
 
 
@@ -56,6 +60,7 @@ using aztec3::circuits::abis::PreviousKernelData;
 using aztec3::circuits::rollup::test_utils::utils::base_rollup_inputs_from_kernels;
 using aztec3::circuits::rollup::test_utils::utils::get_empty_kernel;
 using aztec3::circuits::rollup::test_utils::utils::get_initial_nullifier_tree;
+using aztec3::circuits::rollup::test_utils::utils::get_sibling_path;
 // using aztec3::circuits::mock::mock_kernel_inputs;
 
 using aztec3::circuits::abis::AppendOnlyTreeSnapshot;
@@ -266,6 +271,40 @@ TEST_F(base_rollup_tests, native_contract_leaf_inserted_in_non_empty_snapshot_tr
     run_cbind(inputs, outputs);
 }
 
+TEST_F(base_rollup_tests, native_subtree_root_matches_memory_tree)
+{
+    // The layer-by-layer subtree builder must agree with a MemoryTree built leaf by leaf
+    std::array<fr, (1UL << PRIVATE_DATA_SUBTREE_DEPTH)> leaves{};
+    auto expected_subtree = native_base_rollup::MerkleTree(PRIVATE_DATA_SUBTREE_DEPTH);
+    for (size_t i = 0; i < leaves.size(); i++) {
+        // leave the last leaf as zero to mimic a partially filled subtree
+        leaves[i] = i + 1 < leaves.size() ? fr(i + 1) : fr(0);
+        expected_subtree.update_element(i, leaves[i]);
+    }
+
+    ASSERT_EQ(components::calculate_subtree_root<PRIVATE_DATA_SUBTREE_DEPTH>(leaves), expected_subtree.root());
+    ASSERT_EQ(components::calculate_subtree_root<0>({ fr(7) }), fr(7));
+}
+
+TEST_F(base_rollup_tests, native_empty_tree_roots_match_memory_tree)
+{
+    // The process-wide zero-hash table must agree with freshly built empty trees
+    for (size_t depth = 0; depth <= PRIVATE_DATA_TREE_HEIGHT; depth++) {
+        auto const empty_tree = native_base_rollup::MerkleTree(depth);
+        ASSERT_EQ(components::calculate_empty_tree_root(depth), empty_tree.root());
+    }
+
+    // A non-zero zero-leaf gets its own table
+    auto const zero_leaf = fr(42);
+    auto const empty_path = compute_empty_sibling_path<NT, PRIVATE_DATA_TREE_HEIGHT>(zero_leaf);
+    auto expected_node = zero_leaf;
+    for (size_t i = 0; i < PRIVATE_DATA_TREE_HEIGHT; i++) {
+        ASSERT_EQ(empty_path[i], expected_node);
+        expected_node = NT::merkle_hash(expected_node, expected_node);
+    }
+    ASSERT_EQ(get_empty_tree_root(PRIVATE_DATA_TREE_HEIGHT, zero_leaf), expected_node);
+}
+
 TEST_F(base_rollup_tests, native_new_commitments_tree)
 {
     DummyComposer composer = DummyComposer("base_rollup_tests__native_new_commitments_tree");
@@ -706,6 +745,39 @@ TEST_F(base_rollup_tests, native_cbind_0)
     run_cbind(inputs, ignored_public_inputs, false);
 }
 
+TEST_F(base_rollup_tests, native_view_matches_owned_inputs)
+{
+    BaseRollupInputs inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+    inputs.kernel_data[1].proof.proof_data = { 1, 2, 3 };
+    inputs.kernel_data[1].public_inputs.end.new_commitments[0] = fr(42);
+
+    std::vector<uint8_t> inputs_vec;
+    write(inputs_vec, inputs);
+    uint8_t const* it = inputs_vec.data();
+    BaseRollupInputsView<> view;
+    read(it, view);
+    ASSERT_EQ(it, inputs_vec.data() + inputs_vec.size());
+
+    for (size_t i = 0; i < 2; i++) {
+        auto const& kernel = inputs.kernel_data[i];
+        auto const& kernel_view = view.kernel_data[i];
+        EXPECT_EQ(kernel_view.public_inputs, kernel.public_inputs);
+        EXPECT_EQ(std::vector<uint8_t>(kernel_view.proof.begin(), kernel_view.proof.end()), kernel.proof.proof_data);
+        EXPECT_EQ(kernel_view.vk()->circuit_size, kernel.vk->circuit_size);
+        EXPECT_EQ(kernel_view.vk_index, kernel.vk_index);
+        EXPECT_EQ(kernel_view.vk_path, kernel.vk_path);
+    }
+    EXPECT_EQ(view.constants, inputs.constants);
+
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_view_matches_owned_inputs");
+    BaseOrMergeRollupPublicInputs const outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, inputs);
+    BaseOrMergeRollupPublicInputs const view_outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, view);
+    EXPECT_EQ(view_outputs, outputs);
+    ASSERT_FALSE(composer.failed());
+}
+
 TEST_F(base_rollup_tests, native_single_public_state_read)
 {
     DummyComposer composer = DummyComposer("base_rollup_tests__native_single_public_state_read");
@@ -840,4 +912,227 @@ TEST_F(base_rollup_tests, native_invalid_public_state_read)
     run_cbind(inputs, outputs, true, false);
 }
 
+TEST_F(base_rollup_tests, native_inconsistent_duplicate_public_state_read_path)
+{
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_inconsistent_duplicate_public_state_read_path");
+    native_base_rollup::MerkleTree private_data_tree(PRIVATE_DATA_TREE_HEIGHT);
+    native_base_rollup::MerkleTree contract_tree(CONTRACT_TREE_HEIGHT);
+    stdlib::merkle_tree::MemoryStore public_data_tree_store;
+    native_base_rollup::SparseTree public_data_tree(public_data_tree_store, PUBLIC_DATA_TREE_HEIGHT);
+    native_base_rollup::MerkleTree l1_to_l2_messages_tree(L1_TO_L2_MSG_TREE_HEIGHT);
+
+    // Two reads of the same leaf, each with its own sibling path
+    std::array<PreviousKernelData<NT>, 2> kernel_data = { get_empty_kernel(), get_empty_kernel() };
+    kernel_data[0].public_inputs.end.public_data_reads[0] = make_public_read(fr(1), fr(101));
+    kernel_data[0].public_inputs.end.public_data_reads[1] = make_public_read(fr(1), fr(101));
+    auto inputs = test_utils::utils::base_rollup_inputs_from_kernels(
+        kernel_data, private_data_tree, contract_tree, public_data_tree, l1_to_l2_messages_tree);
+
+    // Every path is checked against the root, not only the first one given for a leaf
+    inputs.new_public_data_reads_sibling_paths[1][PUBLIC_DATA_TREE_HEIGHT - 1] += fr(1);
+
+    aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, inputs);
+
+    ASSERT_TRUE(composer.failed());
+    ASSERT_EQ(composer.get_first_failure().code, native_base_rollup::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+    ASSERT_NE(composer.get_first_failure().message.find("validate_public_data_reads index 1"), std::string::npos);
+}
+
+/**
+ * @brief Inputs of the `base_index`-th of consecutive base rollups of `NUM_KERNELS` empty kernels, on empty trees
+ */
+template <size_t NUM_KERNELS> abis::BaseRollupInputs<NT, NUM_KERNELS> get_empty_base_rollup_inputs(size_t base_index)
+{
+    using Sizes = abis::BaseRollupSizes<NUM_KERNELS>;
+
+    native_base_rollup::MerkleTree private_data_tree(PRIVATE_DATA_TREE_HEIGHT);
+    native_base_rollup::MerkleTree contract_tree(CONTRACT_TREE_HEIGHT);
+    native_base_rollup::MerkleTree nullifier_tree(NULLIFIER_TREE_HEIGHT);
+    native_base_rollup::MerkleTree l1_to_l2_messages_tree(L1_TO_L2_MSG_TREE_HEIGHT);
+
+    // Historic trees hold the current roots at index 0
+    native_base_rollup::MerkleTree historic_private_data_tree(PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT);
+    native_base_rollup::MerkleTree historic_contract_tree(CONTRACT_TREE_ROOTS_TREE_HEIGHT);
+    native_base_rollup::MerkleTree historic_l1_to_l2_msg_tree(L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT);
+    historic_private_data_tree.update_element(0, private_data_tree.root());
+    historic_contract_tree.update_element(0, contract_tree.root());
+    historic_l1_to_l2_msg_tree.update_element(0, l1_to_l2_messages_tree.root());
+
+    // Empty leaves leave the roots unchanged, so earlier base rollups only move the insertion indices
+    auto const commitments_index = static_cast<uint32_t>(base_index * Sizes::NEW_COMMITMENTS_LENGTH);
+    auto const nullifiers_index = static_cast<uint32_t>(base_index * Sizes::NEW_NULLIFIERS_LENGTH);
+    auto const contracts_index = static_cast<uint32_t>(base_index * Sizes::NEW_CONTRACTS_LENGTH);
+
+    abis::BaseRollupInputs<NT, NUM_KERNELS> inputs = {
+        .start_private_data_tree_snapshot = { .root = private_data_tree.root(),
+                                              .next_available_leaf_index = commitments_index },
+        .start_nullifier_tree_snapshot = { .root = nullifier_tree.root(),
+                                           .next_available_leaf_index = nullifiers_index },
+        .start_contract_tree_snapshot = { .root = contract_tree.root(), .next_available_leaf_index = contracts_index },
+        .start_public_data_tree_root = fr(0),
+        .new_commitments_subtree_sibling_path = get_sibling_path<Sizes::PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH>(
+            private_data_tree, commitments_index, Sizes::PRIVATE_DATA_SUBTREE_DEPTH),
+        .new_nullifiers_subtree_sibling_path = get_sibling_path<Sizes::NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH>(
+            nullifier_tree, nullifiers_index, Sizes::NULLIFIER_SUBTREE_DEPTH),
+        .new_contracts_subtree_sibling_path = get_sibling_path<Sizes::CONTRACT_SUBTREE_INCLUSION_CHECK_DEPTH>(
+            contract_tree, contracts_index, Sizes::CONTRACT_SUBTREE_DEPTH),
+        .constants = {
+            .start_tree_of_historic_private_data_tree_roots_snapshot = { .root = historic_private_data_tree.root(),
+                                                                         .next_available_leaf_index = 1 },
+            .start_tree_of_historic_contract_tree_roots_snapshot = { .root = historic_contract_tree.root(),
+                                                                     .next_available_leaf_index = 1 },
+            .start_tree_of_historic_l1_to_l2_msg_tree_roots_snapshot = { .root = historic_l1_to_l2_msg_tree.root(),
+                                                                         .next_available_leaf_index = 1 },
+        },
+    };
+
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        inputs.kernel_data[i] = get_empty_kernel();
+        auto& historic_roots = inputs.kernel_data[i].public_inputs.constants.historic_tree_roots;
+        historic_roots.private_historic_tree_roots.private_data_tree_root = private_data_tree.root();
+        historic_roots.private_historic_tree_roots.contract_tree_root = contract_tree.root();
+        historic_roots.private_historic_tree_roots.l1_to_l2_messages_tree_root = l1_to_l2_messages_tree.root();
+
+        inputs.historic_private_data_tree_root_membership_witnesses[i] = {
+            .leaf_index = 0,
+            .sibling_path = get_sibling_path<PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT>(historic_private_data_tree, 0, 0),
+        };
+        inputs.historic_contract_tree_root_membership_witnesses[i] = {
+            .leaf_index = 0,
+            .sibling_path = get_sibling_path<CONTRACT_TREE_ROOTS_TREE_HEIGHT>(historic_contract_tree, 0, 0),
+        };
+        inputs.historic_l1_to_l2_msg_tree_root_membership_witnesses[i] = {
+            .leaf_index = 0,
+            .sibling_path = get_sibling_path<L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT>(historic_l1_to_l2_msg_tree, 0, 0),
+        };
+    }
+
+    return inputs;
+}
+
+TEST_F(base_rollup_tests, native_four_kernels_no_new_leaves)
+{
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_four_kernels_no_new_leaves");
+    constexpr size_t NUM_KERNELS = 4;
+
+    native_base_rollup::MerkleTree private_data_tree(PRIVATE_DATA_TREE_HEIGHT);
+    native_base_rollup::MerkleTree contract_tree(CONTRACT_TREE_HEIGHT);
+    native_base_rollup::MerkleTree nullifier_tree(NULLIFIER_TREE_HEIGHT);
+    auto const inputs = get_empty_base_rollup_inputs<NUM_KERNELS>(0);
+
+    BaseOrMergeRollupPublicInputs outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, inputs);
+
+    // Empty leaves are still appended, one subtree of all kernels per tree
+    ASSERT_EQ(outputs.end_private_data_tree_snapshot.root, private_data_tree.root());
+    ASSERT_EQ(outputs.end_private_data_tree_snapshot.next_available_leaf_index,
+              NUM_KERNELS * KERNEL_NEW_COMMITMENTS_LENGTH);
+    ASSERT_EQ(outputs.end_nullifier_tree_snapshot.root, nullifier_tree.root());
+    ASSERT_EQ(outputs.end_nullifier_tree_snapshot.next_available_leaf_index,
+              NUM_KERNELS * KERNEL_NEW_NULLIFIERS_LENGTH);
+    ASSERT_EQ(outputs.end_contract_tree_snapshot.root, contract_tree.root());
+    ASSERT_EQ(outputs.end_contract_tree_snapshot.next_available_leaf_index, NUM_KERNELS * KERNEL_NEW_CONTRACTS_LENGTH);
+    ASSERT_EQ(outputs.calldata_hash, components::compute_kernels_calldata_hash(inputs.kernel_data));
+    ASSERT_FALSE(composer.failed());
+}
+
+TEST_F(base_rollup_tests, native_four_kernel_base_rollups_merge)
+{
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_four_kernel_base_rollups_merge");
+    constexpr size_t NUM_KERNELS = 4;
+
+    auto const left = native_base_rollup::base_rollup_circuit(composer, get_empty_base_rollup_inputs<NUM_KERNELS>(0));
+    auto const right = native_base_rollup::base_rollup_circuit(composer, get_empty_base_rollup_inputs<NUM_KERNELS>(1));
+    ASSERT_FALSE(composer.failed());
+    // as many transactions as a merge of two base rollups of 2 kernels
+    ASSERT_EQ(left.rollup_subtree_height, fr(1));
+    ASSERT_EQ(right.rollup_subtree_height, fr(1));
+
+    merge::MergeRollupInputs merge_inputs;
+    merge_inputs.previous_rollup_data[0].base_or_merge_rollup_public_inputs = left;
+    merge_inputs.previous_rollup_data[1].base_or_merge_rollup_public_inputs = right;
+    auto const outputs = merge::merge_rollup_circuit(composer, merge_inputs);
+
+    ASSERT_FALSE(composer.failed());
+    ASSERT_EQ(outputs.rollup_subtree_height, fr(2));
+    ASSERT_EQ(outputs.start_private_data_tree_snapshot, left.start_private_data_tree_snapshot);
+    ASSERT_EQ(outputs.end_private_data_tree_snapshot, right.end_private_data_tree_snapshot);
+    ASSERT_EQ(outputs.end_nullifier_tree_snapshot, right.end_nullifier_tree_snapshot);
+    ASSERT_EQ(outputs.end_contract_tree_snapshot, right.end_contract_tree_snapshot);
+
+    // A base rollup of 2 kernels cannot be merged with one of 4
+    DummyComposer mixed_composer = DummyComposer("base_rollup_tests__native_four_kernel_base_rollups_merge_mixed");
+    merge_inputs.previous_rollup_data[1].base_or_merge_rollup_public_inputs.rollup_subtree_height = fr(0);
+    merge::merge_rollup_circuit(mixed_composer, merge_inputs);
+    ASSERT_TRUE(mixed_composer.failed());
+    ASSERT_EQ(mixed_composer.get_first_failure().code, native_base_rollup::CircuitErrorCode::ROLLUP_HEIGHT_MISMATCH);
+}
+
+TEST_F(base_rollup_tests, native_four_kernel_calldata_hash_matches_merge_of_two_kernel_bases)
+{
+    DummyComposer composer =
+        DummyComposer("base_rollup_tests__native_four_kernel_calldata_hash_matches_merge_of_two_kernel_bases");
+
+    // The kernels of the base rollup of 4, split between the two base rollups of 2
+    auto four_kernel_inputs = get_empty_base_rollup_inputs<4>(0);
+    std::array<abis::BaseRollupInputs<NT, 2>, 2> two_kernel_inputs = { get_empty_base_rollup_inputs<2>(0),
+                                                                       get_empty_base_rollup_inputs<2>(1) };
+    for (size_t i = 0; i < 4; i++) {
+        auto& end = four_kernel_inputs.kernel_data[i].public_inputs.end;
+        for (size_t j = 0; j < KERNEL_NEW_COMMITMENTS_LENGTH; j++) {
+            end.new_commitments[j] = fr(i * KERNEL_NEW_COMMITMENTS_LENGTH + j + 1);
+        }
+        for (size_t j = 0; j < KERNEL_NEW_L2_TO_L1_MSGS_LENGTH; j++) {
+            end.new_l2_to_l1_msgs[j] = fr::random_element();
+        }
+        two_kernel_inputs[i / 2].kernel_data[i % 2].public_inputs.end = end;
+    }
+    NewContractData<NT> const new_contract = {
+        .contract_address = fr(1),
+        .portal_contract_address = fr(3),
+        .function_tree_root = fr(2),
+    };
+    four_kernel_inputs.kernel_data[2].public_inputs.end.new_contracts[0] = new_contract;
+    two_kernel_inputs[1].kernel_data[0].public_inputs.end.new_contracts[0] = new_contract;
+
+    auto const four_kernel_outputs = native_base_rollup::base_rollup_circuit(composer, four_kernel_inputs);
+    std::array<abis::PreviousRollupData<NT>, 2> two_kernel_rollup_data;
+    for (size_t i = 0; i < 2; i++) {
+        two_kernel_rollup_data[i].base_or_merge_rollup_public_inputs =
+            native_base_rollup::base_rollup_circuit(composer, two_kernel_inputs[i]);
+    }
+    ASSERT_FALSE(composer.failed());
+
+    // as the merge rollup of the two base rollups of 2 kernels computes it
+    ASSERT_EQ(four_kernel_outputs.calldata_hash, components::compute_calldata_hash(two_kernel_rollup_data));
+    ASSERT_NE(two_kernel_rollup_data[0].base_or_merge_rollup_public_inputs.calldata_hash,
+              two_kernel_rollup_data[1].base_or_merge_rollup_public_inputs.calldata_hash);
+}
+
+TEST_F(base_rollup_tests, native_roots_from_sibling_paths_match_root_from_sibling_path)
+{
+    // leaves on either side of each level, including the first and last leaves of the tree
+    constexpr size_t HEIGHT = 4;
+    std::array<fr, 5> const leaf_indices = { fr(0), fr(5), fr(6), fr(10), fr(15) };
+    std::array<fr, 5> leaves;
+    std::array<std::array<fr, HEIGHT>, 5> sibling_paths;
+    for (size_t i = 0; i < leaves.size(); i++) {
+        leaves[i] = fr::random_element();
+        for (auto& sibling : sibling_paths[i]) {
+            sibling = fr::random_element();
+        }
+    }
+
+    std::array<std::array<fr, HEIGHT> const*, 5> sibling_path_pointers;
+    for (size_t i = 0; i < leaves.size(); i++) {
+        sibling_path_pointers[i] = &sibling_paths[i];
+    }
+    auto roots = leaves;
+    aztec3::circuits::roots_from_sibling_paths<HEIGHT>(roots, leaf_indices, sibling_path_pointers);
+
+    for (size_t i = 0; i < leaves.size(); i++) {
+        ASSERT_EQ(roots[i], root_from_sibling_path<NT>(leaves[i], leaf_indices[i], sibling_paths[i]));
+    }
+}
+
 }  // namespace aztec3::circuits::rollup::base::native_base_rollup_circuit
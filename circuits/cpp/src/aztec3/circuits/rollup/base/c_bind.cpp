@@ -7,6 +7,8 @@
 #include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
 #include "aztec3/circuits/abis/signed_tx_request.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/sim_batch.hpp"
+#include "aztec3/utils/write_to_buffer.hpp"
 #include <aztec3/circuits/abis/kernel_circuit_public_inputs.hpp>
 #include <aztec3/circuits/mock/mock_kernel_circuit.hpp>
 #include <aztec3/constants.hpp>
@@ -21,8 +23,10 @@ using Composer = plonk::UltraComposer;
 using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::abis::BaseOrMergeRollupPublicInputs;
-using aztec3::circuits::abis::BaseRollupInputs;
+using aztec3::circuits::abis::BaseRollupInputsView;
 using aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit;
+using aztec3::utils::simulate_serialized_batch;
+using aztec3::utils::write_to_buffer;
 
 }  // namespace
 
@@ -64,7 +68,9 @@ WASM_EXPORT uint8_t* base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
     // TODO do we want to accept it or just get it from our factory?
     // auto crs_factory = std::make_shared<EnvReferenceStringFactory>();
 
-    BaseRollupInputs<NT> base_rollup_inputs;
+    // the kernels' proofs and verification keys are left in `base_rollup_inputs_buf`, which the native circuit doesn't
+    // read
+    BaseRollupInputsView<> base_rollup_inputs;
     read(base_rollup_inputs_buf, base_rollup_inputs);
 
     BaseOrMergeRollupPublicInputs<NT> const public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
@@ -87,6 +93,36 @@ WASM_EXPORT uint8_t* base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
     return composer.alloc_and_serialize_first_failure();
 }
 
+// Same as base_rollup__sim, but the public inputs are written to the caller's buffer `public_inputs_buf` of
+// `public_inputs_capacity` bytes (see write_to_buffer): their size is written to `public_inputs_size_out`, and nothing
+// is written to the buffer if they don't fit.
+WASM_EXPORT uint8_t* base_rollup__sim_into(uint8_t const* base_rollup_inputs_buf,
+                                           uint8_t* public_inputs_buf,
+                                           size_t public_inputs_capacity,
+                                           size_t* public_inputs_size_out)
+{
+    DummyComposer composer = DummyComposer("base_rollup__sim_into");
+    BaseRollupInputsView<> base_rollup_inputs;
+    read(base_rollup_inputs_buf, base_rollup_inputs);
+
+    *public_inputs_size_out = write_to_buffer(
+        base_rollup_circuit(composer, base_rollup_inputs), public_inputs_buf, public_inputs_capacity);
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Simulates each base rollup of the vector `base_rollup_inputs_buf`, in parallel on native builds. Writes the vector of
+// their public inputs and first failures (SimBatchResult) to `results_buf`, and returns its size.
+WASM_EXPORT size_t base_rollup__sim_batch(uint8_t const* base_rollup_inputs_buf, uint8_t const** results_buf)
+{
+    return simulate_serialized_batch<BaseRollupInputsView<>>(
+        "base_rollup__sim_batch",
+        base_rollup_inputs_buf,
+        results_buf,
+        [](DummyComposer& composer, BaseRollupInputsView<> const& base_rollup_inputs) {
+            return base_rollup_circuit(composer, base_rollup_inputs);
+        });
+}
+
 // WASM_EXPORT size_t base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
 //                                    bool second_present,
 //                                    uint8_t const** base_or_merge_rollup_public_inputs_buf)
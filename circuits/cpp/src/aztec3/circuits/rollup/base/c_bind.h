@@ -11,6 +11,11 @@ WASM_EXPORT size_t base_rollup__dummy_previous_rollup(uint8_t const** previous_r
 WASM_EXPORT uint8_t*  base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
                                        size_t* base_rollup_public_inputs_size_out,
                                        uint8_t const** base_or_merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* base_rollup__sim_into(uint8_t const* base_rollup_inputs_buf,
+                                           uint8_t* public_inputs_buf,
+                                           size_t public_inputs_capacity,
+                                           size_t* public_inputs_size_out);
+WASM_EXPORT size_t base_rollup__sim_batch(uint8_t const* base_rollup_inputs_buf, uint8_t const** results_buf);
 WASM_EXPORT size_t base_rollup__verify_proof(uint8_t const* vk_buf,
                                              uint8_t const* proof,
                                              uint32_t length);
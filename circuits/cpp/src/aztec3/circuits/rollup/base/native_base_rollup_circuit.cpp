@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <span>
 #include <iostream>
 #include <tuple>
 #include <vector>
@@ -29,18 +30,17 @@
 
 namespace aztec3::circuits::rollup::native_base_rollup {
 
-NT::fr calculate_empty_tree_root(const size_t depth)
+// TODO: can we aggregate proofs if we do not have a working circuit impl
+
+bool verify_kernel_proof(std::span<uint8_t const> kernel_proof_data)
 {
-    MerkleTree const empty_tree = MerkleTree(depth);
-    return empty_tree.root();
+    (void)kernel_proof_data;
+    return true;
 }
 
-// TODO: can we aggregate proofs if we do not have a working circuit impl
-
 bool verify_kernel_proof(NT::Proof const& kernel_proof)
 {
-    (void)kernel_proof;
-    return true;
+    return verify_kernel_proof(kernel_proof.proof_data);
 }
 
 /**
@@ -52,7 +52,8 @@ bool verify_kernel_proof(NT::Proof const& kernel_proof)
  * @param baseRollupInputs
  * @return AggregationObject
  */
-AggregationObject aggregate_proofs(BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+AggregationObject aggregate_proofs(abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
     // TODO: NOTE: for now we simply return the aggregation object from the first proof
     return baseRollupInputs.kernel_data[0].public_inputs.end.aggregation_object;
@@ -68,44 +69,47 @@ NT::fr get_prover_contribution_hash()
     return NT::fr(0);
 }
 
-std::vector<NT::fr> calculate_contract_leaves(BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+std::array<NT::fr, abis::BaseRollupSizes<NUM_KERNELS>::NEW_CONTRACTS_LENGTH> calculate_contract_leaves(
+    abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
-    std::vector<NT::fr> contract_leaves;
+    std::array<NT::fr, abis::BaseRollupSizes<NUM_KERNELS>::NEW_CONTRACTS_LENGTH> contract_leaves{};
 
-    for (size_t i = 0; i < 2; i++) {
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
         auto new_contacts = baseRollupInputs.kernel_data[i].public_inputs.end.new_contracts;
 
         // loop over the new contracts
         // TODO: NOTE: we are currently assuming that there is only going to be one
-        for (auto& leaf_preimage : new_contacts) {
+        for (size_t j = 0; j < new_contacts.size(); j++) {
+            auto const& leaf_preimage = new_contacts[j];
             // When there is no contract deployment, we should insert a zero leaf into the tree and ignore the
             // member-ship check. This is to ensure that we don't hit "already deployed" errors when we are not
             // deploying contracts. e.g., when we are only calling functions on existing contracts.
             auto to_push = leaf_preimage.contract_address == NT::address(0) ? NT::fr(0) : leaf_preimage.hash();
-            contract_leaves.push_back(to_push);
+            contract_leaves[i * KERNEL_NEW_CONTRACTS_LENGTH + j] = to_push;
         }
     }
 
     return contract_leaves;
 }
 
-NT::fr calculate_contract_subtree(std::vector<NT::fr> contract_leaves)
+template <size_t NUM_KERNELS>
+NT::fr calculate_contract_subtree(
+    std::array<NT::fr, abis::BaseRollupSizes<NUM_KERNELS>::NEW_CONTRACTS_LENGTH> const& contract_leaves)
 {
-    MerkleTree contracts_tree = MerkleTree(CONTRACT_SUBTREE_DEPTH);
-
     // Compute the merkle root of a contract subtree
-    // Contracts subtree
-    for (size_t i = 0; i < contract_leaves.size(); i++) {
-        contracts_tree.update_element(i, contract_leaves[i]);
-    }
-    return contracts_tree.root();
+    return components::calculate_subtree_root<abis::BaseRollupSizes<NUM_KERNELS>::CONTRACT_SUBTREE_DEPTH>(
+        contract_leaves);
 }
 
-NT::fr calculate_commitments_subtree(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+NT::fr calculate_commitments_subtree(DummyComposer& composer,
+                                     abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
-    MerkleTree commitments_tree = MerkleTree(PRIVATE_DATA_SUBTREE_DEPTH);
+    using Sizes = abis::BaseRollupSizes<NUM_KERNELS>;
+    std::array<NT::fr, Sizes::NEW_COMMITMENTS_LENGTH> commitment_leaves{};
 
-    for (size_t i = 0; i < 2; i++) {
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
         auto new_commitments = baseRollupInputs.kernel_data[i].public_inputs.end.new_commitments;
 
         // Our commitments size MUST be 4 to calculate our subtrees correctly
@@ -114,13 +118,12 @@ NT::fr calculate_commitments_subtree(DummyComposer& composer, BaseRollupInputs c
                            CircuitErrorCode::BASE__INCORRECT_NUM_OF_NEW_COMMITMENTS);
 
         for (size_t j = 0; j < new_commitments.size(); j++) {
-            // todo: batch insert
-            commitments_tree.update_element(i * KERNEL_NEW_COMMITMENTS_LENGTH + j, new_commitments[j]);
+            commitment_leaves[i * KERNEL_NEW_COMMITMENTS_LENGTH + j] = new_commitments[j];
         }
     }
 
     // Commitments subtree
-    return commitments_tree.root();
+    return components::calculate_subtree_root<Sizes::PRIVATE_DATA_SUBTREE_DEPTH>(commitment_leaves);
 }
 
 /**
@@ -129,85 +132,97 @@ NT::fr calculate_commitments_subtree(DummyComposer& composer, BaseRollupInputs c
  * @param constantBaseRollupData
  * @param baseRollupInputs
  */
-void perform_historical_private_data_tree_membership_checks(DummyComposer& composer,
-                                                            BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+void perform_historical_private_data_tree_membership_checks(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
     // For each of the historic_private_data_tree_membership_checks, we need to do an inclusion proof
     // against the historical root provided in the rollup constants
     auto historic_root = baseRollupInputs.constants.start_tree_of_historic_private_data_tree_roots_snapshot.root;
 
-    for (size_t i = 0; i < 2; i++) {
-        NT::fr const leaf =
-            baseRollupInputs.kernel_data[i]
-                .public_inputs.constants.historic_tree_roots.private_historic_tree_roots.private_data_tree_root;
-        abis::MembershipWitness<NT, PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT> const historic_root_witness =
-            baseRollupInputs.historic_private_data_tree_root_membership_witnesses[i];
-
-        check_membership<NT>(composer,
-                             leaf,
-                             historic_root_witness.leaf_index,
-                             historic_root_witness.sibling_path,
-                             historic_root,
-                             format("historic private data tree roots ", i));
+    // The paths of all the kernels lead to the same root, so their roots are calculated together
+    std::array<NT::fr, NUM_KERNELS> leaves;
+    std::array<NT::fr, NUM_KERNELS> leaf_indices;
+    std::array<std::array<NT::fr, PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT> const*, NUM_KERNELS> sibling_paths;
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        auto const& historic_tree_roots =
+            baseRollupInputs.kernel_data[i].public_inputs.constants.historic_tree_roots.private_historic_tree_roots;
+        leaves[i] = historic_tree_roots.private_data_tree_root;
+        leaf_indices[i] = baseRollupInputs.historic_private_data_tree_root_membership_witnesses[i].leaf_index;
+        sibling_paths[i] = &baseRollupInputs.historic_private_data_tree_root_membership_witnesses[i].sibling_path;
     }
+
+    check_memberships<PRIVATE_DATA_TREE_ROOTS_TREE_HEIGHT>(
+        composer, leaves, leaf_indices, sibling_paths, historic_root, [](size_t i) {
+            return format("historic private data tree roots ", i);
+        });
 }
 
-void perform_historical_contract_data_tree_membership_checks(DummyComposer& composer,
-                                                             BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+void perform_historical_contract_data_tree_membership_checks(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
     auto historic_root = baseRollupInputs.constants.start_tree_of_historic_contract_tree_roots_snapshot.root;
 
-    for (size_t i = 0; i < 2; i++) {
-        NT::fr const leaf =
-            baseRollupInputs.kernel_data[i]
-                .public_inputs.constants.historic_tree_roots.private_historic_tree_roots.contract_tree_root;
-        abis::MembershipWitness<NT, CONTRACT_TREE_ROOTS_TREE_HEIGHT> const historic_root_witness =
-            baseRollupInputs.historic_contract_tree_root_membership_witnesses[i];
-
-        check_membership<NT>(composer,
-                             leaf,
-                             historic_root_witness.leaf_index,
-                             historic_root_witness.sibling_path,
-                             historic_root,
-                             format("historic contract data tree roots ", i));
+    // The paths of all the kernels lead to the same root, so their roots are calculated together
+    std::array<NT::fr, NUM_KERNELS> leaves;
+    std::array<NT::fr, NUM_KERNELS> leaf_indices;
+    std::array<std::array<NT::fr, CONTRACT_TREE_ROOTS_TREE_HEIGHT> const*, NUM_KERNELS> sibling_paths;
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        auto const& historic_tree_roots =
+            baseRollupInputs.kernel_data[i].public_inputs.constants.historic_tree_roots.private_historic_tree_roots;
+        leaves[i] = historic_tree_roots.contract_tree_root;
+        leaf_indices[i] = baseRollupInputs.historic_contract_tree_root_membership_witnesses[i].leaf_index;
+        sibling_paths[i] = &baseRollupInputs.historic_contract_tree_root_membership_witnesses[i].sibling_path;
     }
+
+    check_memberships<CONTRACT_TREE_ROOTS_TREE_HEIGHT>(
+        composer, leaves, leaf_indices, sibling_paths, historic_root, [](size_t i) {
+            return format("historic contract data tree roots ", i);
+        });
 }
 
-void perform_historical_l1_to_l2_message_tree_membership_checks(DummyComposer& composer,
-                                                                BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+void perform_historical_l1_to_l2_message_tree_membership_checks(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
     auto historic_root = baseRollupInputs.constants.start_tree_of_historic_l1_to_l2_msg_tree_roots_snapshot.root;
 
-    for (size_t i = 0; i < 2; i++) {
-        NT::fr const leaf =
-            baseRollupInputs.kernel_data[i]
-                .public_inputs.constants.historic_tree_roots.private_historic_tree_roots.l1_to_l2_messages_tree_root;
-        abis::MembershipWitness<NT, L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT> const historic_root_witness =
-            baseRollupInputs.historic_l1_to_l2_msg_tree_root_membership_witnesses[i];
-
-        check_membership<NT>(composer,
-                             leaf,
-                             historic_root_witness.leaf_index,
-                             historic_root_witness.sibling_path,
-                             historic_root,
-                             format("historic l1 to l2 data tree roots ", i));
+    // The paths of all the kernels lead to the same root, so their roots are calculated together
+    std::array<NT::fr, NUM_KERNELS> leaves;
+    std::array<NT::fr, NUM_KERNELS> leaf_indices;
+    std::array<std::array<NT::fr, L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT> const*, NUM_KERNELS> sibling_paths;
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        auto const& historic_tree_roots =
+            baseRollupInputs.kernel_data[i].public_inputs.constants.historic_tree_roots.private_historic_tree_roots;
+        leaves[i] = historic_tree_roots.l1_to_l2_messages_tree_root;
+        leaf_indices[i] = baseRollupInputs.historic_l1_to_l2_msg_tree_root_membership_witnesses[i].leaf_index;
+        sibling_paths[i] = &baseRollupInputs.historic_l1_to_l2_msg_tree_root_membership_witnesses[i].sibling_path;
     }
+
+    check_memberships<L1_TO_L2_MSG_TREE_ROOTS_TREE_HEIGHT>(
+        composer, leaves, leaf_indices, sibling_paths, historic_root, [](size_t i) {
+            return format("historic l1 to l2 data tree roots ", i);
+        });
 }
 
-NT::fr create_nullifier_subtree(std::array<NullifierLeaf, KERNEL_NEW_NULLIFIERS_LENGTH * 2> const& nullifier_leaves)
+template <size_t NUM_KERNELS>
+NT::fr create_nullifier_subtree(
+    std::array<NullifierLeaf, abis::BaseRollupSizes<NUM_KERNELS>::NEW_NULLIFIERS_LENGTH> const& nullifier_leaves)
 {
+    using Sizes = abis::BaseRollupSizes<NUM_KERNELS>;
     // Build a merkle tree of the nullifiers
-    MerkleTree nullifier_subtree = MerkleTree(NULLIFIER_SUBTREE_DEPTH);
+    std::array<NT::fr, Sizes::NEW_NULLIFIERS_LENGTH> nullifier_subtree_leaves{};
     for (size_t i = 0; i < nullifier_leaves.size(); i++) {
         // check if the nullifier is zero, if so dont insert
         if (uint256_t(nullifier_leaves[i].value) == uint256_t(0)) {
-            nullifier_subtree.update_element(i, fr::zero());
+            nullifier_subtree_leaves[i] = fr::zero();
         } else {
-            nullifier_subtree.update_element(i, nullifier_leaves[i].hash());
+            nullifier_subtree_leaves[i] = nullifier_leaves[i].hash();
         }
     }
 
-    return nullifier_subtree.root();
+    return components::calculate_subtree_root<Sizes::NULLIFIER_SUBTREE_DEPTH>(nullifier_subtree_leaves);
 }
 
 /**
@@ -215,9 +230,12 @@ NT::fr create_nullifier_subtree(std::array<NullifierLeaf, KERNEL_NEW_NULLIFIERS_
  *
  * @returns The end nullifier tree root
  */
-AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyComposer& composer,
-                                                                          BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
+    using Sizes = abis::BaseRollupSizes<NUM_KERNELS>;
+
     // LADIES AND GENTLEMEN The P L A N ( is simple )
     // 1. Get the previous nullifier set setup
     // 2. Check for the first added nullifier that it doesnt exist
@@ -233,7 +251,7 @@ AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyC
     // 2. If we receive the 0 nullifier leaf (where all values are 0, we skip insertion and leave a sparse subtree)
 
     // New nullifier subtree
-    std::array<NullifierLeaf, KERNEL_NEW_NULLIFIERS_LENGTH * 2> nullifier_insertion_subtree;
+    std::array<NullifierLeaf, Sizes::NEW_NULLIFIERS_LENGTH> nullifier_insertion_subtree;
 
     // This will update on each iteration
     auto current_nullifier_tree_root = baseRollupInputs.start_nullifier_tree_snapshot.root;
@@ -243,14 +261,14 @@ AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyC
     auto new_index = start_insertion_index;
 
     // For each kernel circuit
-    for (size_t i = 0; i < 2; i++) {
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
         auto new_nullifiers = baseRollupInputs.kernel_data[i].public_inputs.end.new_nullifiers;
         // For each of our nullifiers
         for (size_t j = 0; j < KERNEL_NEW_NULLIFIERS_LENGTH; j++) {
             // Witness containing index and path
-            auto nullifier_index = 4 * i + j;
+            auto nullifier_index = KERNEL_NEW_NULLIFIERS_LENGTH * i + j;
 
-            auto witness = baseRollupInputs.low_nullifier_membership_witness[nullifier_index];
+            auto const& witness = baseRollupInputs.low_nullifier_membership_witness[nullifier_index];
             // Preimage of the lo-index required for a non-membership proof
             auto low_nullifier_preimage = baseRollupInputs.low_nullifier_leaf_preimages[nullifier_index];
             // Newly created nullifier
@@ -347,9 +365,9 @@ AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyC
     }
 
     // Check that the new subtree is to be inserted at the next location, and is empty currently
-    const auto empty_nullifier_subtree_root = components::calculate_empty_tree_root(NULLIFIER_SUBTREE_DEPTH);
+    const auto empty_nullifier_subtree_root = components::calculate_empty_tree_root(Sizes::NULLIFIER_SUBTREE_DEPTH);
     auto leafIndexNullifierSubtreeDepth =
-        baseRollupInputs.start_nullifier_tree_snapshot.next_available_leaf_index >> NULLIFIER_SUBTREE_DEPTH;
+        baseRollupInputs.start_nullifier_tree_snapshot.next_available_leaf_index >> Sizes::NULLIFIER_SUBTREE_DEPTH;
     check_membership<NT>(composer,
                          empty_nullifier_subtree_root,
                          leafIndexNullifierSubtreeDepth,
@@ -359,11 +377,11 @@ AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyC
 
     // Create new nullifier subtree to insert into the whole nullifier tree
     auto nullifier_sibling_path = baseRollupInputs.new_nullifiers_subtree_sibling_path;
-    auto nullifier_subtree_root = create_nullifier_subtree(nullifier_insertion_subtree);
+    auto nullifier_subtree_root = create_nullifier_subtree<NUM_KERNELS>(nullifier_insertion_subtree);
 
     // Calculate the new root
     // We are inserting a subtree rather than a full tree here
-    auto subtree_index = start_insertion_index >> (NULLIFIER_SUBTREE_DEPTH);
+    auto subtree_index = start_insertion_index >> (Sizes::NULLIFIER_SUBTREE_DEPTH);
     auto new_root = root_from_sibling_path<NT>(nullifier_subtree_root, subtree_index, nullifier_sibling_path);
 
     // Return the new state of the nullifier tree
@@ -373,13 +391,15 @@ AppendOnlySnapshot check_nullifier_tree_non_membership_and_insert_to_tree(DummyC
     };
 }
 
-fr insert_public_data_update_requests(
+using PublicDataSiblingPath = std::array<fr, PUBLIC_DATA_TREE_HEIGHT>;
+
+template <size_t NUM_WITNESSES> fr insert_public_data_update_requests(
     DummyComposer& composer,
     fr tree_root,
     std::array<abis::PublicDataUpdateRequest<NT>, KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH> const&
         public_data_update_requests,
     size_t witnesses_offset,
-    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, 2 * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH> const& witnesses)
+    std::array<PublicDataSiblingPath, NUM_WITNESSES> const& witnesses)
 {
     auto root = tree_root;
 
@@ -396,7 +416,7 @@ fr insert_public_data_update_requests(
                              state_write.leaf_index,
                              witness,
                              root,
-                             format("validate_public_data_update_requests index ", i));
+                             [&] { return format("validate_public_data_update_requests index ", i); });
 
         root = root_from_sibling_path<NT>(state_write.new_value, state_write.leaf_index, witness);
     }
@@ -404,101 +424,103 @@ fr insert_public_data_update_requests(
     return root;
 }
 
-void validate_public_data_reads(
+template <size_t NUM_WITNESSES> void validate_public_data_reads(
     DummyComposer& composer,
     fr tree_root,
     std::array<abis::PublicDataRead<NT>, KERNEL_PUBLIC_DATA_READS_LENGTH> const& public_data_reads,
     size_t witnesses_offset,
-    std::array<std::array<fr, PUBLIC_DATA_TREE_HEIGHT>, 2 * KERNEL_PUBLIC_DATA_READS_LENGTH> const& witnesses)
+    std::array<PublicDataSiblingPath, NUM_WITNESSES> const& witnesses)
 {
+    // The reads of a kernel are all against the same root, so their roots are calculated together
+    std::vector<fr> values;
+    std::vector<fr> leaf_indices;
+    std::vector<PublicDataSiblingPath const*> sibling_paths;
+    std::vector<size_t> read_indices;
     for (size_t i = 0; i < KERNEL_PUBLIC_DATA_READS_LENGTH; ++i) {
         const auto& public_data_read = public_data_reads[i];
-        const auto& witness = witnesses[i + witnesses_offset];
 
         if (public_data_read.is_empty()) {
             continue;
         }
 
-        check_membership<NT>(composer,
-                             public_data_read.value,
-                             public_data_read.leaf_index,
-                             witness,
-                             tree_root,
-                             format("validate_public_data_reads index ", i + witnesses_offset));
+        values.push_back(public_data_read.value);
+        leaf_indices.push_back(public_data_read.leaf_index);
+        sibling_paths.push_back(&witnesses[i + witnesses_offset]);
+        read_indices.push_back(i);
     }
+
+    check_memberships<PUBLIC_DATA_TREE_HEIGHT>(composer, values, leaf_indices, sibling_paths, tree_root, [&](size_t j) {
+        return format("validate_public_data_reads index ", read_indices[j] + witnesses_offset);
+    });
 };
 
-fr validate_and_process_public_state(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+fr validate_and_process_public_state(DummyComposer& composer,
+                                      abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
-    // Process public data reads and public data update requests for left input
-    validate_public_data_reads(composer,
-                               baseRollupInputs.start_public_data_tree_root,
-                               baseRollupInputs.kernel_data[0].public_inputs.end.public_data_reads,
-                               0,
-                               baseRollupInputs.new_public_data_reads_sibling_paths);
-
-    auto mid_public_data_tree_root = insert_public_data_update_requests(
-        composer,
-        baseRollupInputs.start_public_data_tree_root,
-        baseRollupInputs.kernel_data[0].public_inputs.end.public_data_update_requests,
-        0,
-        baseRollupInputs.new_public_data_update_requests_sibling_paths);
-
-    // Process public data reads and public data update requests for right input using the resulting tree root from the
-    // left one
-    validate_public_data_reads(composer,
-                               mid_public_data_tree_root,
-                               baseRollupInputs.kernel_data[1].public_inputs.end.public_data_reads,
-                               KERNEL_PUBLIC_DATA_READS_LENGTH,
-                               baseRollupInputs.new_public_data_reads_sibling_paths);
-
-    auto end_public_data_tree_root = insert_public_data_update_requests(
-        composer,
-        mid_public_data_tree_root,
-        baseRollupInputs.kernel_data[1].public_inputs.end.public_data_update_requests,
-        KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH,
-        baseRollupInputs.new_public_data_update_requests_sibling_paths);
-
-    return end_public_data_tree_root;
+    auto public_data_tree_root = baseRollupInputs.start_public_data_tree_root;
+
+    // Process public data reads and public data update requests for each input in turn, each on top of the tree
+    // resulting from the previous one
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        validate_public_data_reads(composer,
+                                   public_data_tree_root,
+                                   baseRollupInputs.kernel_data[i].public_inputs.end.public_data_reads,
+                                   i * KERNEL_PUBLIC_DATA_READS_LENGTH,
+                                   baseRollupInputs.new_public_data_reads_sibling_paths);
+
+        public_data_tree_root = insert_public_data_update_requests(
+            composer,
+            public_data_tree_root,
+            baseRollupInputs.kernel_data[i].public_inputs.end.public_data_update_requests,
+            i * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH,
+            baseRollupInputs.new_public_data_update_requests_sibling_paths);
+    }
+
+    return public_data_tree_root;
 }
 
-BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs)
+template <size_t NUM_KERNELS, typename KernelData>
+BaseOrMergeRollupPublicInputs base_rollup_circuit(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs)
 {
+    using Sizes = abis::BaseRollupSizes<NUM_KERNELS>;
+
     // Verify the previous kernel proofs
-    for (size_t i = 0; i < 2; i++) {
-        NT::Proof const proof = baseRollupInputs.kernel_data[i].proof;
-        composer.do_assert(verify_kernel_proof(proof),
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        composer.do_assert(verify_kernel_proof(baseRollupInputs.kernel_data[i].proof),
                            "kernel proof verification failed",
                            CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
     }
 
     // First we compute the contract tree leaves
-    std::vector<NT::fr> const contract_leaves = calculate_contract_leaves(baseRollupInputs);
+    auto const contract_leaves = calculate_contract_leaves(baseRollupInputs);
 
     // Check contracts and commitments subtrees
-    NT::fr const contracts_tree_subroot = calculate_contract_subtree(contract_leaves);
+    NT::fr const contracts_tree_subroot = calculate_contract_subtree<NUM_KERNELS>(contract_leaves);
     NT::fr const commitments_tree_subroot = calculate_commitments_subtree(composer, baseRollupInputs);
 
     // Insert commitment subtrees:
-    const auto empty_commitments_subtree_root = components::calculate_empty_tree_root(PRIVATE_DATA_SUBTREE_DEPTH);
+    const auto empty_commitments_subtree_root =
+        components::calculate_empty_tree_root(Sizes::PRIVATE_DATA_SUBTREE_DEPTH);
     auto end_private_data_tree_snapshot =
         components::insert_subtree_to_snapshot_tree(composer,
                                                     baseRollupInputs.start_private_data_tree_snapshot,
                                                     baseRollupInputs.new_commitments_subtree_sibling_path,
                                                     empty_commitments_subtree_root,
                                                     commitments_tree_subroot,
-                                                    PRIVATE_DATA_SUBTREE_DEPTH,
+                                                    Sizes::PRIVATE_DATA_SUBTREE_DEPTH,
                                                     "empty commitment subtree membership check");
 
     // Insert contract subtrees:
-    const auto empty_contracts_subtree_root = components::calculate_empty_tree_root(CONTRACT_SUBTREE_DEPTH);
+    const auto empty_contracts_subtree_root = components::calculate_empty_tree_root(Sizes::CONTRACT_SUBTREE_DEPTH);
     auto end_contract_tree_snapshot =
         components::insert_subtree_to_snapshot_tree(composer,
                                                     baseRollupInputs.start_contract_tree_snapshot,
                                                     baseRollupInputs.new_contracts_subtree_sibling_path,
                                                     empty_contracts_subtree_root,
                                                     contracts_tree_subroot,
-                                                    CONTRACT_SUBTREE_DEPTH,
+                                                    Sizes::CONTRACT_SUBTREE_DEPTH,
                                                     "empty contract subtree membership check");
 
     // Insert nullifiers:
@@ -520,7 +542,7 @@ BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseR
 
     BaseOrMergeRollupPublicInputs public_inputs = {
         .rollup_type = abis::BASE_ROLLUP_TYPE,
-        .rollup_subtree_height = fr(0),
+        .rollup_subtree_height = fr(Sizes::ROLLUP_SUBTREE_HEIGHT),
         .end_aggregation_object = aggregation_object,
         .constants = baseRollupInputs.constants,
         .start_private_data_tree_snapshot = baseRollupInputs.start_private_data_tree_snapshot,
@@ -536,4 +558,13 @@ BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseR
     return public_inputs;
 }
 
+template BaseOrMergeRollupPublicInputs base_rollup_circuit<2>(DummyComposer& composer,
+                                                              abis::BaseRollupInputs<NT, 2> const& baseRollupInputs);
+template BaseOrMergeRollupPublicInputs base_rollup_circuit<4>(DummyComposer& composer,
+                                                              abis::BaseRollupInputs<NT, 4> const& baseRollupInputs);
+template BaseOrMergeRollupPublicInputs base_rollup_circuit<8>(DummyComposer& composer,
+                                                              abis::BaseRollupInputs<NT, 8> const& baseRollupInputs);
+template BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer,
+                                                           abis::BaseRollupInputsView<2> const& baseRollupInputs);
+
 }  // namespace aztec3::circuits::rollup::native_base_rollup
\ No newline at end of file
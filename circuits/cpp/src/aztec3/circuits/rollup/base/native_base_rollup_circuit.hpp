@@ -13,6 +13,23 @@
 
 namespace aztec3::circuits::rollup::native_base_rollup {
 
-BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs);
+/**
+ * @brief Simulates a base rollup over `NUM_KERNELS` kernels
+ *
+ * @details Instantiated for 2 (the default, and the only size exposed over the c_binds), 4 and 8 kernels, and for
+ * views of 2 kernels (`BaseRollupInputsView`), which the c_binds read.
+ */
+template <size_t NUM_KERNELS, typename KernelData>
+BaseOrMergeRollupPublicInputs base_rollup_circuit(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, NUM_KERNELS, KernelData> const& baseRollupInputs);
+
+extern template BaseOrMergeRollupPublicInputs base_rollup_circuit<2>(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, 2> const& baseRollupInputs);
+extern template BaseOrMergeRollupPublicInputs base_rollup_circuit<4>(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, 4> const& baseRollupInputs);
+extern template BaseOrMergeRollupPublicInputs base_rollup_circuit<8>(
+    DummyComposer& composer, abis::BaseRollupInputs<NT, 8> const& baseRollupInputs);
+extern template BaseOrMergeRollupPublicInputs base_rollup_circuit(
+    DummyComposer& composer, abis::BaseRollupInputsView<2> const& baseRollupInputs);
 
 }  // namespace aztec3::circuits::rollup::native_base_rollup
\ No newline at end of file
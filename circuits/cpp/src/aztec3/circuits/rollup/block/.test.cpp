@@ -0,0 +1,238 @@
+#include "c_bind.h"
+#include "index.hpp"
+#include "init.hpp"
+
+#include "aztec3/circuits/abis/membership_witness.hpp"
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/circuits/rollup/base/native_base_rollup_circuit.hpp"
+#include "aztec3/circuits/rollup/merge/native_merge_rollup_circuit.hpp"
+#include "aztec3/circuits/rollup/root/native_root_rollup_circuit.hpp"
+#include "aztec3/circuits/rollup/test_utils/utils.hpp"
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include "barretenberg/stdlib/merkle_tree/memory_tree.hpp"
+#include <barretenberg/common/test.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using aztec3::circuits::rollup::test_utils::utils::base_rollup_inputs_from_kernels;
+using aztec3::circuits::rollup::test_utils::utils::get_base_rollup_inputs;
+using aztec3::circuits::rollup::test_utils::utils::get_empty_kernel;
+using aztec3::circuits::rollup::test_utils::utils::get_empty_l1_to_l2_messages;
+using aztec3::circuits::rollup::test_utils::utils::get_initial_nullifier_tree;
+using aztec3::circuits::rollup::test_utils::utils::get_root_rollup_inputs;
+using aztec3::circuits::rollup::test_utils::utils::get_sibling_path;
+
+using aztec3::circuits::rollup::block::BaseRollupInputs;
+using aztec3::circuits::rollup::block::BlockRollupLevelTiming;
+using aztec3::circuits::rollup::block::BlockRollupOutput;
+using aztec3::circuits::rollup::block::BlockRollupSimulator;
+using aztec3::circuits::rollup::block::MergeRollupInputs;
+using aztec3::circuits::rollup::block::NT;
+using aztec3::circuits::rollup::block::PreviousRollupData;
+using aztec3::circuits::rollup::block::RootRollupInputs;
+using aztec3::circuits::rollup::block::RootRollupPublicInputs;
+
+using MemoryTree = stdlib::merkle_tree::MemoryTree;
+using KernelData = aztec3::circuits::abis::PreviousKernelData<NT>;
+}  // namespace
+
+namespace aztec3::circuits::rollup::block::native_block_rollup_simulator {
+
+class block_rollup_tests : public ::testing::Test {
+  protected:
+    /**
+     * @brief Inputs of consecutive base rollups of empty kernels
+     *
+     * @details Empty kernels only append empty leaves, so no tree root changes and each base rollup just starts
+     * inserting where the previous one stopped.
+     */
+    static std::vector<BaseRollupInputs> get_empty_base_rollup_inputs(size_t num_base_rollups)
+    {
+        auto const first = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+        MemoryTree private_data_tree(PRIVATE_DATA_TREE_HEIGHT);
+        MemoryTree contract_tree(CONTRACT_TREE_HEIGHT);
+        // the nullifier tree base_rollup_inputs_from_kernels starts from
+        auto nullifier_tree = get_initial_nullifier_tree({ 1, 2, 3, 4, 5, 6, 7 });
+        EXPECT_EQ(nullifier_tree.root(), first.start_nullifier_tree_snapshot.root);
+
+        std::vector<BaseRollupInputs> inputs(num_base_rollups, first);
+        for (size_t i = 1; i < num_base_rollups; i++) {
+            auto& input = inputs[i];
+            auto const& previous = inputs[i - 1];
+
+            input.start_private_data_tree_snapshot.next_available_leaf_index =
+                previous.start_private_data_tree_snapshot.next_available_leaf_index +
+                static_cast<NT::uint32>(2 * KERNEL_NEW_COMMITMENTS_LENGTH);
+            input.start_nullifier_tree_snapshot.next_available_leaf_index =
+                previous.start_nullifier_tree_snapshot.next_available_leaf_index +
+                static_cast<NT::uint32>(2 * KERNEL_NEW_NULLIFIERS_LENGTH);
+            input.start_contract_tree_snapshot.next_available_leaf_index =
+                previous.start_contract_tree_snapshot.next_available_leaf_index +
+                static_cast<NT::uint32>(2 * KERNEL_NEW_CONTRACTS_LENGTH);
+
+            input.new_commitments_subtree_sibling_path = get_sibling_path<PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH>(
+                private_data_tree,
+                input.start_private_data_tree_snapshot.next_available_leaf_index,
+                PRIVATE_DATA_SUBTREE_DEPTH);
+            input.new_nullifiers_subtree_sibling_path = get_sibling_path<NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH>(
+                nullifier_tree, input.start_nullifier_tree_snapshot.next_available_leaf_index, NULLIFIER_SUBTREE_DEPTH);
+            input.new_contracts_subtree_sibling_path = get_sibling_path<CONTRACT_SUBTREE_INCLUSION_CHECK_DEPTH>(
+                contract_tree, input.start_contract_tree_snapshot.next_available_leaf_index, CONTRACT_SUBTREE_DEPTH);
+        }
+        return inputs;
+    }
+
+    /**
+     * @brief Simulate the rollups of a block one at a time, merging them layer by layer
+     */
+    static RootRollupPublicInputs simulate_sequentially(DummyComposer& composer,
+                                                        std::vector<BaseRollupInputs> const& base_rollup_inputs,
+                                                        RootRollupInputs root_rollup_inputs)
+    {
+        std::vector<PreviousRollupData> layer;
+        for (auto const& inputs : base_rollup_inputs) {
+            layer.push_back({
+                .base_or_merge_rollup_public_inputs = native_base_rollup::base_rollup_circuit(composer, inputs),
+                .proof = inputs.kernel_data[0].proof,
+                .vk = inputs.kernel_data[0].vk,
+                .vk_index = 0,
+                .vk_sibling_path = abis::MembershipWitness<NT, ROLLUP_VK_TREE_HEIGHT>(),
+            });
+        }
+
+        while (layer.size() > 2) {
+            std::vector<PreviousRollupData> next_layer;
+            for (size_t i = 0; i < layer.size(); i += 2) {
+                MergeRollupInputs const merge_rollup_inputs = { .previous_rollup_data = { layer[i], layer[i + 1] } };
+                next_layer.push_back({
+                    .base_or_merge_rollup_public_inputs = merge::merge_rollup_circuit(composer, merge_rollup_inputs),
+                    .proof = layer[i].proof,
+                    .vk = layer[i].vk,
+                    .vk_index = 0,
+                    .vk_sibling_path = abis::MembershipWitness<NT, ROLLUP_VK_TREE_HEIGHT>(),
+                });
+            }
+            layer = next_layer;
+        }
+
+        root_rollup_inputs.previous_rollup_data = { layer[0], layer[1] };
+        return native_root_rollup::root_rollup_circuit(composer, root_rollup_inputs);
+    }
+};
+
+TEST_F(block_rollup_tests, native_two_base_rollups_match_root_rollup)
+{
+    DummyComposer composer = DummyComposer("block_rollup_tests__native_two_base_rollups_match_root_rollup");
+    std::array<KernelData, 4> kernels = {
+        get_empty_kernel(), get_empty_kernel(), get_empty_kernel(), get_empty_kernel()
+    };
+    for (size_t i = 0; i < kernels.size(); i++) {
+        kernels[i].public_inputs.end.new_commitments[0] = fr(i + 1);
+    }
+
+    RootRollupInputs const root_rollup_inputs =
+        get_root_rollup_inputs(composer, kernels, get_empty_l1_to_l2_messages());
+    RootRollupPublicInputs const expected = native_root_rollup::root_rollup_circuit(composer, root_rollup_inputs);
+    auto const base_rollup_inputs = get_base_rollup_inputs(composer, kernels);
+    ASSERT_FALSE(composer.failed());
+
+    BlockRollupSimulator simulator({ base_rollup_inputs[0], base_rollup_inputs[1] }, root_rollup_inputs);
+    BlockRollupOutput const output = simulator.simulate(composer);
+
+    ASSERT_FALSE(composer.failed());
+    ASSERT_EQ(output.public_inputs, expected);
+    ASSERT_EQ(output.level_timings.size(), static_cast<size_t>(2));
+    ASSERT_EQ(output.level_timings[0].num_circuits, static_cast<size_t>(2));
+    ASSERT_EQ(output.level_timings[1].num_circuits, static_cast<size_t>(1));
+    ASSERT_GE(output.level_timings[1].completed_at_ms, output.level_timings[0].completed_at_ms);
+
+    // Again via the cbind
+    std::vector<BaseRollupInputs> const base_rollup_inputs_vec = { base_rollup_inputs[0], base_rollup_inputs[1] };
+    std::vector<uint8_t> base_rollup_inputs_buf;
+    write(base_rollup_inputs_buf, base_rollup_inputs_vec);
+    std::vector<uint8_t> root_rollup_inputs_buf;
+    write(root_rollup_inputs_buf, root_rollup_inputs);
+
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    uint8_t const* level_timings_buf = nullptr;
+    size_t level_timings_size = 0;
+    uint8_t* const circuit_failure_ptr = block_rollup__sim(base_rollup_inputs_buf.data(),
+                                                           root_rollup_inputs_buf.data(),
+                                                           &public_inputs_size,
+                                                           &public_inputs_buf,
+                                                           &level_timings_size,
+                                                           &level_timings_buf);
+    ASSERT_TRUE(circuit_failure_ptr == nullptr);
+
+    std::vector<uint8_t> expected_public_inputs_vec;
+    write(expected_public_inputs_vec, expected);
+    ASSERT_EQ(std::vector<uint8_t>(public_inputs_buf, public_inputs_buf + public_inputs_size),
+              expected_public_inputs_vec);
+    free((void*)public_inputs_buf);
+
+    std::vector<BlockRollupLevelTiming> level_timings;
+    uint8_t const* level_timings_it = level_timings_buf;
+    read(level_timings_it, level_timings);
+    ASSERT_EQ(static_cast<size_t>(level_timings_it - level_timings_buf), level_timings_size);
+    ASSERT_EQ(level_timings.size(), static_cast<size_t>(2));
+    ASSERT_EQ(level_timings[0].num_circuits, static_cast<size_t>(2));
+    ASSERT_EQ(level_timings[1].num_circuits, static_cast<size_t>(1));
+    ASSERT_GE(level_timings[1].completed_at_ms, level_timings[0].completed_at_ms);
+    free((void*)level_timings_buf);
+}
+
+TEST_F(block_rollup_tests, native_eight_base_rollups_match_sequential_merges)
+{
+    DummyComposer composer = DummyComposer("block_rollup_tests__native_eight_base_rollups_match_sequential_merges");
+    std::array<KernelData, 4> const kernels = {
+        get_empty_kernel(), get_empty_kernel(), get_empty_kernel(), get_empty_kernel()
+    };
+    RootRollupInputs const root_rollup_inputs =
+        get_root_rollup_inputs(composer, kernels, get_empty_l1_to_l2_messages());
+    auto const base_rollup_inputs = get_empty_base_rollup_inputs(8);
+
+    RootRollupPublicInputs const expected = simulate_sequentially(composer, base_rollup_inputs, root_rollup_inputs);
+    ASSERT_FALSE(composer.failed());
+    ASSERT_EQ(expected.end_private_data_tree_snapshot.next_available_leaf_index,
+              8 * 2 * KERNEL_NEW_COMMITMENTS_LENGTH);
+
+    BlockRollupSimulator simulator(base_rollup_inputs, root_rollup_inputs);
+    BlockRollupOutput const output = simulator.simulate(composer);
+
+    ASSERT_FALSE(composer.failed());
+    ASSERT_EQ(output.public_inputs, expected);
+    // base rollups, two layers of merges, root
+    ASSERT_EQ(output.level_timings.size(), static_cast<size_t>(4));
+    ASSERT_EQ(output.level_timings[0].num_circuits, static_cast<size_t>(8));
+    ASSERT_EQ(output.level_timings[1].num_circuits, static_cast<size_t>(4));
+    ASSERT_EQ(output.level_timings[2].num_circuits, static_cast<size_t>(2));
+    ASSERT_EQ(output.level_timings[3].num_circuits, static_cast<size_t>(1));
+}
+
+TEST_F(block_rollup_tests, native_unbalanced_block_fails)
+{
+    DummyComposer composer = DummyComposer("block_rollup_tests__native_unbalanced_block_fails");
+    std::array<KernelData, 4> const kernels = {
+        get_empty_kernel(), get_empty_kernel(), get_empty_kernel(), get_empty_kernel()
+    };
+    RootRollupInputs const root_rollup_inputs =
+        get_root_rollup_inputs(composer, kernels, get_empty_l1_to_l2_messages());
+
+    BlockRollupSimulator simulator(get_empty_base_rollup_inputs(3), root_rollup_inputs);
+    BlockRollupOutput const output = simulator.simulate(composer);
+
+    ASSERT_TRUE(composer.failed());
+    ASSERT_EQ(composer.get_first_failure().code, utils::CircuitErrorCode::ROOT__INVALID_NUMBER_OF_BASE_ROLLUPS);
+    ASSERT_TRUE(output.level_timings.empty());
+}
+
+}  // namespace aztec3::circuits::rollup::block::native_block_rollup_simulator
@@ -0,0 +1,67 @@
+#include "c_bind.h"
+
+#include "index.hpp"
+#include "init.hpp"
+
+#include "aztec3/utils/dummy_composer.hpp"
+#include <aztec3/utils/types/native_types.hpp>
+
+#include "barretenberg/common/serialize.hpp"
+
+namespace {
+using NT = aztec3::utils::types::NativeTypes;
+using DummyComposer = aztec3::utils::DummyComposer;
+using aztec3::circuits::rollup::block::BaseRollupInputs;
+using aztec3::circuits::rollup::block::BlockRollupOutput;
+using aztec3::circuits::rollup::block::BlockRollupSimulator;
+using aztec3::circuits::rollup::block::RootRollupInputs;
+
+}  // namespace
+
+#define WASM_EXPORT __attribute__((visibility("default")))
+// WASM Cbinds
+extern "C" {
+
+/**
+ * @brief Simulates all the rollup circuits of a block in one call
+ *
+ * @param base_rollup_inputs_buf A serialized vector of the inputs of every base rollup, in block order
+ * @param root_rollup_inputs_buf Serialized root rollup inputs, whose `previous_rollup_data` is ignored
+ * @param level_timings_buf Set to a serialized vector of the `BlockRollupLevelTiming` of each level of the block, from
+ * the base rollups to the root rollup
+ */
+WASM_EXPORT uint8_t* block_rollup__sim(uint8_t const* base_rollup_inputs_buf,
+                                       uint8_t const* root_rollup_inputs_buf,
+                                       size_t* root_rollup_public_inputs_size_out,
+                                       uint8_t const** root_rollup_public_inputs_buf,
+                                       size_t* level_timings_size_out,
+                                       uint8_t const** level_timings_buf)
+{
+    std::vector<BaseRollupInputs> base_rollup_inputs;
+    read(base_rollup_inputs_buf, base_rollup_inputs);
+    RootRollupInputs root_rollup_inputs;
+    read(root_rollup_inputs_buf, root_rollup_inputs);
+
+    DummyComposer composer = DummyComposer("block_rollup__sim");
+    BlockRollupSimulator simulator(std::move(base_rollup_inputs), std::move(root_rollup_inputs));
+    BlockRollupOutput const output = simulator.simulate(composer);
+
+    // serialize public inputs to bytes vec
+    std::vector<uint8_t> public_inputs_vec;
+    write(public_inputs_vec, output.public_inputs);
+    // copy public inputs to output buffer
+    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
+    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
+    *root_rollup_public_inputs_buf = raw_public_inputs_buf;
+    *root_rollup_public_inputs_size_out = public_inputs_vec.size();
+
+    std::vector<uint8_t> level_timings_vec;
+    write(level_timings_vec, output.level_timings);
+    auto* raw_level_timings_buf = (uint8_t*)malloc(level_timings_vec.size());
+    memcpy(raw_level_timings_buf, (void*)level_timings_vec.data(), level_timings_vec.size());
+    *level_timings_buf = raw_level_timings_buf;
+    *level_timings_size_out = level_timings_vec.size();
+    return composer.alloc_and_serialize_first_failure();
+}
+
+}  // extern "C"
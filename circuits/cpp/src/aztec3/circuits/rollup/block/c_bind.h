@@ -0,0 +1,14 @@
+#include <cstdint>
+#include <cstddef>
+
+#define WASM_EXPORT __attribute__((visibility("default")))
+
+extern "C" {
+
+WASM_EXPORT uint8_t* block_rollup__sim(uint8_t const* base_rollup_inputs_buf,
+                                       uint8_t const* root_rollup_inputs_buf,
+                                       size_t* root_rollup_public_inputs_size_out,
+                                       uint8_t const** root_rollup_public_inputs_buf,
+                                       size_t* level_timings_size_out,
+                                       uint8_t const** level_timings_buf);
+}
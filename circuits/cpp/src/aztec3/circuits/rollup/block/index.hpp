@@ -0,0 +1,2 @@
+#include "init.hpp"
+#include "native_block_rollup_simulator.hpp"
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
+#include "aztec3/circuits/abis/rollup/base/base_rollup_inputs.hpp"
+#include "aztec3/circuits/abis/rollup/merge/merge_rollup_inputs.hpp"
+#include "aztec3/circuits/abis/rollup/merge/previous_rollup_data.hpp"
+#include "aztec3/circuits/abis/rollup/root/root_rollup_inputs.hpp"
+#include "aztec3/circuits/abis/rollup/root/root_rollup_public_inputs.hpp"
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+#include <aztec3/utils/types/native_types.hpp>
+
+namespace aztec3::circuits::rollup::block {
+
+using NT = aztec3::utils::types::NativeTypes;
+using DummyComposer = aztec3::utils::DummyComposer;
+using CircuitErrorCode = aztec3::utils::CircuitErrorCode;
+
+// Params
+using BaseRollupInputs = abis::BaseRollupInputs<NT>;
+using BaseOrMergeRollupPublicInputs = abis::BaseOrMergeRollupPublicInputs<NT>;
+using MergeRollupInputs = abis::MergeRollupInputs<NT>;
+using PreviousRollupData = abis::PreviousRollupData<NT>;
+using RootRollupInputs = abis::RootRollupInputs<NT>;
+using RootRollupPublicInputs = abis::RootRollupPublicInputs<NT>;
+
+}  // namespace aztec3::circuits::rollup::block
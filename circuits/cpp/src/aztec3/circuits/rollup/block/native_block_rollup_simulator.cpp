@@ -0,0 +1,175 @@
+#include "native_block_rollup_simulator.hpp"
+
+#include "init.hpp"
+
+#include "aztec3/circuits/abis/membership_witness.hpp"
+#include "aztec3/circuits/rollup/base/native_base_rollup_circuit.hpp"
+#include "aztec3/circuits/rollup/merge/native_merge_rollup_circuit.hpp"
+#include "aztec3/circuits/rollup/root/native_root_rollup_circuit.hpp"
+#include "aztec3/constants.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aztec3::circuits::rollup::block {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point from, Clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+/**
+ * @brief Wrap the outputs of a base or merge rollup as an input of the rollup above it
+ *
+ * @details Rollup proofs are not produced by the native simulation, so the proof and vk given are placeholders (the
+ * ones of the first kernel of the leftmost base rollup below), as the merge and root rollups do not check them yet.
+ */
+PreviousRollupData to_previous_rollup_data(BaseOrMergeRollupPublicInputs const& public_inputs,
+                                           NT::Proof const& proof,
+                                           std::shared_ptr<NT::VK> const& vk)
+{
+    return {
+        .base_or_merge_rollup_public_inputs = public_inputs,
+        .proof = proof,
+        .vk = vk,
+        .vk_index = 0,
+        .vk_sibling_path = abis::MembershipWitness<NT, ROLLUP_VK_TREE_HEIGHT>(),
+    };
+}
+
+}  // namespace
+
+BlockRollupSimulator::BlockRollupSimulator(std::vector<BaseRollupInputs> base_rollup_inputs,
+                                           RootRollupInputs root_rollup_inputs)
+    : base_rollup_inputs(std::move(base_rollup_inputs)), root_rollup_inputs(std::move(root_rollup_inputs))
+{}
+
+void BlockRollupSimulator::finish_run(CircuitRun& run, Clock::time_point started) const
+{
+    auto const finished = Clock::now();
+    run.duration_ms = elapsed_ms(started, finished);
+    run.finished_at_ms = elapsed_ms(start_time, finished);
+}
+
+/**
+ * @brief Simulate the rollup at `index` in `level` of the tree, and all the rollups below it
+ *
+ * @details The left subtree is spawned as a task while the calling thread simulates the right one, and the merge
+ * rollup runs once both are done.
+ */
+PreviousRollupData BlockRollupSimulator::simulate_subtree(size_t level, size_t index)
+{
+    if (level == 0) {
+        auto& run = runs[0][index];
+        auto const& inputs = base_rollup_inputs[index];
+        auto const started = Clock::now();
+        auto const public_inputs = native_base_rollup::base_rollup_circuit(run.composer, inputs);
+        finish_run(run, started);
+        return to_previous_rollup_data(public_inputs, inputs.kernel_data[0].proof, inputs.kernel_data[0].vk);
+    }
+
+    PreviousRollupData left;
+    PreviousRollupData right;
+#ifndef NO_MULTITHREADING
+#pragma omp task shared(left)
+#endif
+    left = simulate_subtree(level - 1, 2 * index);
+    right = simulate_subtree(level - 1, 2 * index + 1);
+#ifndef NO_MULTITHREADING
+#pragma omp taskwait
+#endif
+
+    auto& run = runs[level][index];
+    MergeRollupInputs const merge_rollup_inputs = { .previous_rollup_data = { left, right } };
+    auto const started = Clock::now();
+    auto const public_inputs = merge::merge_rollup_circuit(run.composer, merge_rollup_inputs);
+    finish_run(run, started);
+    return to_previous_rollup_data(public_inputs, left.proof, left.vk);
+}
+
+BlockRollupOutput BlockRollupSimulator::simulate(DummyComposer& composer)
+{
+    auto const num_base_rollups = base_rollup_inputs.size();
+    bool const is_power_of_two = num_base_rollups >= 2 && (num_base_rollups & (num_base_rollups - 1)) == 0;
+    composer.do_assert(is_power_of_two,
+                       "the number of base rollups in a block must be a power of 2 of at least 2",
+                       CircuitErrorCode::ROOT__INVALID_NUMBER_OF_BASE_ROLLUPS);
+    if (!is_power_of_two) {
+        return {};
+    }
+
+    // The root rollup sits at level `root_level`, the two rollups it takes as inputs at the level below
+    size_t root_level = 0;
+    while ((1UL << root_level) < num_base_rollups) {
+        root_level++;
+    }
+
+    runs.clear();
+    runs.resize(root_level + 1);
+    for (size_t level = 0; level <= root_level; level++) {
+        std::string circuit_name = "block_rollup__merge_" + std::to_string(level) + "_";
+        if (level == 0) {
+            circuit_name = "block_rollup__base_";
+        } else if (level == root_level) {
+            circuit_name = "block_rollup__root_";
+        }
+        size_t const num_circuits = level == root_level ? 1 : num_base_rollups >> level;
+        for (size_t index = 0; index < num_circuits; index++) {
+            runs[level].push_back(CircuitRun{ .composer = DummyComposer(circuit_name + std::to_string(index)) });
+        }
+    }
+
+    start_time = Clock::now();
+
+    PreviousRollupData left;
+    PreviousRollupData right;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel
+#pragma omp single
+#endif
+    {
+#ifndef NO_MULTITHREADING
+#pragma omp task shared(left)
+#endif
+        left = simulate_subtree(root_level - 1, 0);
+        right = simulate_subtree(root_level - 1, 1);
+#ifndef NO_MULTITHREADING
+#pragma omp taskwait
+#endif
+    }
+
+    auto& root_run = runs[root_level][0];
+    root_rollup_inputs.previous_rollup_data = { left, right };
+    auto const started = Clock::now();
+    BlockRollupOutput output = {
+        .public_inputs = native_root_rollup::root_rollup_circuit(root_run.composer, root_rollup_inputs),
+    };
+    finish_run(root_run, started);
+
+    // Report failures and timings level by level, in tree order
+    for (auto const& level_runs : runs) {
+        BlockRollupLevelTiming timing = { .num_circuits = level_runs.size() };
+        for (auto const& run : level_runs) {
+            for (auto const& failure : run.composer.failure_msgs) {
+                composer.do_assert(false,
+                                   run.composer.method_name + ": " + failure.message,
+                                   static_cast<CircuitErrorCode>(failure.code));
+            }
+            timing.circuits_ms += run.duration_ms;
+            timing.completed_at_ms = std::max(timing.completed_at_ms, run.finished_at_ms);
+        }
+        output.level_timings.push_back(timing);
+    }
+
+    return output;
+}
+
+}  // namespace aztec3::circuits::rollup::block
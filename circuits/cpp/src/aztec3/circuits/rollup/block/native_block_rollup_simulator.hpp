@@ -0,0 +1,100 @@
+#pragma once
+
+#include "init.hpp"
+
+#include "barretenberg/common/serialize.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aztec3::circuits::rollup::block {
+
+/**
+ * @brief Timings of one level of the rollup tree: the base rollups, each layer of merge rollups, or the root rollup
+ *
+ * - `num_circuits` the number of circuits simulated at this level
+ * - `circuits_ms` the time spent simulating them, summed over all of them
+ * - `completed_at_ms` the time from the start of the block until the last of them finished
+ */
+struct BlockRollupLevelTiming {
+    size_t num_circuits = 0;
+    double circuits_ms = 0;
+    double completed_at_ms = 0;
+};
+
+// the durations are serialized in whole microseconds
+inline void read(uint8_t const*& it, BlockRollupLevelTiming& timing)
+{
+    using serialize::read;
+
+    uint32_t num_circuits = 0;
+    uint64_t circuits_us = 0;
+    uint64_t completed_at_us = 0;
+    read(it, num_circuits);
+    read(it, circuits_us);
+    read(it, completed_at_us);
+    timing.num_circuits = num_circuits;
+    timing.circuits_ms = static_cast<double>(circuits_us) / 1000;
+    timing.completed_at_ms = static_cast<double>(completed_at_us) / 1000;
+};
+
+inline void write(std::vector<uint8_t>& buf, BlockRollupLevelTiming const& timing)
+{
+    using serialize::write;
+
+    write(buf, static_cast<uint32_t>(timing.num_circuits));
+    write(buf, static_cast<uint64_t>(timing.circuits_ms * 1000));
+    write(buf, static_cast<uint64_t>(timing.completed_at_ms * 1000));
+};
+
+struct BlockRollupOutput {
+    RootRollupPublicInputs public_inputs;
+    // the base rollups first and the root rollup last
+    std::vector<BlockRollupLevelTiming> level_timings;
+};
+
+/**
+ * @brief Simulates a whole block natively: its base rollups, the merge rollups above them and the root rollup
+ *
+ * @details The base rollups are independent of each other (their start snapshots are part of their inputs), so they
+ * are all simulated in parallel, and each merge rollup is simulated as soon as both of its children have finished.
+ * Natively, every circuit is an OpenMP task so idle threads steal whatever work is ready; with NO_MULTITHREADING the
+ * same tree is simulated depth first on the calling thread.
+ *
+ * Every circuit records its failures on its own composer. Once the block is done, they are copied to the caller's
+ * composer in a fixed order (base rollups left to right, then each layer of merges, then the root), so the first
+ * failure reported does not depend on scheduling.
+ */
+class BlockRollupSimulator {
+  public:
+    /**
+     * @param base_rollup_inputs The inputs of every base rollup, in block order. Their number must be a power of 2
+     * of at least 2.
+     * @param root_rollup_inputs The root rollup inputs besides its `previous_rollup_data`, which is replaced by the
+     * outputs of the two topmost rollups of the block.
+     */
+    BlockRollupSimulator(std::vector<BaseRollupInputs> base_rollup_inputs, RootRollupInputs root_rollup_inputs);
+
+    BlockRollupOutput simulate(DummyComposer& composer);
+
+  private:
+    struct CircuitRun {
+        DummyComposer composer;
+        double duration_ms = 0;
+        double finished_at_ms = 0;
+    };
+
+    PreviousRollupData simulate_subtree(size_t level, size_t index);
+    void finish_run(CircuitRun& run, std::chrono::steady_clock::time_point started) const;
+
+    std::vector<BaseRollupInputs> base_rollup_inputs;
+    RootRollupInputs root_rollup_inputs;
+
+    // runs[level][index], where level 0 holds the base rollups and the last level the root rollup
+    std::vector<std::vector<CircuitRun>> runs;
+    std::chrono::steady_clock::time_point start_time;
+};
+
+}  // namespace aztec3::circuits::rollup::block
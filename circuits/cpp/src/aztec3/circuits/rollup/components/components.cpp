@@ -1,5 +1,6 @@
 #include "init.hpp"
 
+#include "aztec3/circuits/abis/previous_kernel_data_view.hpp"
 #include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
@@ -8,7 +9,6 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
-#include "barretenberg/stdlib/merkle_tree/memory_tree.hpp"
 
 #include <algorithm>
 #include <array>
@@ -22,13 +22,14 @@ namespace aztec3::circuits::rollup::components {
 /**
  * @brief Get the root of an empty tree of a given depth
  *
+ * @details Served from the process-wide zero-hash table, so no tree is built.
+ *
  * @param depth
  * @return NT::fr
  */
 NT::fr calculate_empty_tree_root(const size_t depth)
 {
-    stdlib::merkle_tree::MemoryTree const empty_tree = stdlib::merkle_tree::MemoryTree(depth);
-    return empty_tree.root();
+    return get_empty_tree_root(depth);
 }
 
 /**
@@ -96,43 +97,87 @@ void assert_equal_constants(DummyComposer& composer,
 }
 
 /**
- * @brief Computes the calldata hash for a base rollup
+ * @brief From two calldata hashes, compute a single calldata hash
+ *
+ * @param calldata_hashes takes the 4 elements of 2 calldata hashes [high, low, high, low]
+ * @return std::array<fr, 2>
+ */
+std::array<fr, 2> compute_calldata_hash(std::array<fr, 4> calldata_hashes)
+{
+    // Generate a 512 bit input from right and left 256 bit hashes
+    constexpr auto num_bytes = 2 * 32;
+    std::array<uint8_t, num_bytes> calldata_hash_input_bytes;
+    for (uint8_t i = 0; i < 4; i++) {
+        auto half = calldata_hashes[i].to_buffer();
+        for (uint8_t j = 0; j < 16; j++) {
+            calldata_hash_input_bytes[i * 16 + j] = half[16 + j];
+        }
+    }
+
+    // Compute the sha256
+    std::vector<uint8_t> const calldata_hash_input_bytes_vec(calldata_hash_input_bytes.begin(),
+                                                             calldata_hash_input_bytes.end());
+    auto h = sha256::sha256(calldata_hash_input_bytes_vec);
+
+    // Split the hash into two fields, a high and a low
+    std::array<uint8_t, 32> buf_1;
+    std::array<uint8_t, 32> buf_2;
+    for (uint8_t i = 0; i < 16; i++) {
+        buf_1[i] = 0;
+        buf_1[16 + i] = h[i];
+        buf_2[i] = 0;
+        buf_2[16 + i] = h[i + 16];
+    }
+    auto high = fr::serialize_from_buffer(buf_1.data());
+    auto low = fr::serialize_from_buffer(buf_2.data());
+
+    return { high, low };
+}
+
+namespace {
+
+/**
+ * @brief Computes the calldata hash of a pair of kernels, that of a base rollup of 2 kernels
  *
- * @param kernel_data - 2 kernels
+ * @tparam KernelData `PreviousKernelData<NT>`, or a view of it (`PreviousKernelDataView`)
+ * @param kernel_data - the pair of kernels
  * @return std::array<fr, 2>
  */
-std::array<fr, 2> compute_kernels_calldata_hash(std::array<abis::PreviousKernelData<NT>, 2> kernel_data)
+template <typename KernelData>
+std::array<fr, 2> compute_kernel_pair_calldata_hash(std::array<KernelData const*, 2> const& kernel_data)
 {
+    constexpr size_t NUM_KERNELS = 2;
+
     // Compute calldata hashes
-    // Consist of 2 kernels
-    // 8 commitments (4 per kernel) -> 8 fields
-    // 8 nullifiers (4 per kernel) -> 8 fields
-    // 8 public data update requests (4 per kernel) -> 16 fields
-    // 4 l2 -> l1 messages (2 per kernel) -> 4 fields
-    // 2 contract deployments (1 per kernel) -> 6 fields
+    // Consist of 2 kernels, each contributing
+    // 4 commitments -> 4 fields
+    // 4 nullifiers -> 4 fields
+    // 4 public data update requests -> 8 fields
+    // 2 l2 -> l1 messages -> 2 fields
+    // 1 contract deployment -> 3 fields
     auto const number_of_inputs =
         (KERNEL_NEW_COMMITMENTS_LENGTH + KERNEL_NEW_NULLIFIERS_LENGTH + KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH * 2 +
          KERNEL_NEW_L2_TO_L1_MSGS_LENGTH + KERNEL_NEW_CONTRACTS_LENGTH * 3) *
-        2;
+        NUM_KERNELS;
     std::array<NT::fr, number_of_inputs> calldata_hash_inputs;
 
-    for (size_t i = 0; i < 2; i++) {
-        auto new_commitments = kernel_data[i].public_inputs.end.new_commitments;
-        auto new_nullifiers = kernel_data[i].public_inputs.end.new_nullifiers;
-        auto public_data_update_requests = kernel_data[i].public_inputs.end.public_data_update_requests;
-        auto newL2ToL1msgs = kernel_data[i].public_inputs.end.new_l2_to_l1_msgs;
+    for (size_t i = 0; i < NUM_KERNELS; i++) {
+        auto new_commitments = kernel_data[i]->public_inputs.end.new_commitments;
+        auto new_nullifiers = kernel_data[i]->public_inputs.end.new_nullifiers;
+        auto public_data_update_requests = kernel_data[i]->public_inputs.end.public_data_update_requests;
+        auto newL2ToL1msgs = kernel_data[i]->public_inputs.end.new_l2_to_l1_msgs;
 
         size_t offset = 0;
 
         for (size_t j = 0; j < KERNEL_NEW_COMMITMENTS_LENGTH; j++) {
             calldata_hash_inputs[offset + i * KERNEL_NEW_COMMITMENTS_LENGTH + j] = new_commitments[j];
         }
-        offset += KERNEL_NEW_COMMITMENTS_LENGTH * 2;
+        offset += KERNEL_NEW_COMMITMENTS_LENGTH * NUM_KERNELS;
 
         for (size_t j = 0; j < KERNEL_NEW_NULLIFIERS_LENGTH; j++) {
             calldata_hash_inputs[offset + i * KERNEL_NEW_NULLIFIERS_LENGTH + j] = new_nullifiers[j];
         }
-        offset += KERNEL_NEW_NULLIFIERS_LENGTH * 2;
+        offset += KERNEL_NEW_NULLIFIERS_LENGTH * NUM_KERNELS;
 
         for (size_t j = 0; j < KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH; j++) {
             calldata_hash_inputs[offset + i * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH * 2 + j * 2] =
@@ -140,19 +185,19 @@ std::array<fr, 2> compute_kernels_calldata_hash(std::array<abis::PreviousKernelD
             calldata_hash_inputs[offset + i * KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH * 2 + j * 2 + 1] =
                 public_data_update_requests[j].new_value;
         }
-        offset += KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH * 2 * 2;
+        offset += KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH * 2 * NUM_KERNELS;
 
         for (size_t j = 0; j < KERNEL_NEW_L2_TO_L1_MSGS_LENGTH; j++) {
             calldata_hash_inputs[offset + i * KERNEL_NEW_L2_TO_L1_MSGS_LENGTH + j] = newL2ToL1msgs[j];
         }
-        offset += KERNEL_NEW_L2_TO_L1_MSGS_LENGTH * 2;
+        offset += KERNEL_NEW_L2_TO_L1_MSGS_LENGTH * NUM_KERNELS;
 
-        auto const contract_leaf = kernel_data[i].public_inputs.end.new_contracts[0];
+        auto const contract_leaf = kernel_data[i]->public_inputs.end.new_contracts[0];
         calldata_hash_inputs[offset + i] = contract_leaf.is_empty() ? NT::fr::zero() : contract_leaf.hash();
 
-        offset += KERNEL_NEW_CONTRACTS_LENGTH * 2;
+        offset += KERNEL_NEW_CONTRACTS_LENGTH * NUM_KERNELS;
 
-        auto new_contracts = kernel_data[i].public_inputs.end.new_contracts;
+        auto new_contracts = kernel_data[i]->public_inputs.end.new_contracts;
         calldata_hash_inputs[offset + i * 2] = new_contracts[0].contract_address;
         calldata_hash_inputs[offset + i * 2 + 1] = new_contracts[0].portal_contract_address;
     }
@@ -187,44 +232,55 @@ std::array<fr, 2> compute_kernels_calldata_hash(std::array<abis::PreviousKernelD
     return std::array<NT::fr, 2>{ high, low };
 }
 
+}  // namespace
+
 /**
- * @brief From two calldata hashes, compute a single calldata hash
+ * @brief Computes the calldata hash for a base rollup
  *
- * @param calldata_hashes takes the 4 elements of 2 calldata hashes [high, low, high, low]
+ * @details The calldata hash of each pair of kernels is that of a base rollup of 2 kernels, and the pairs are combined
+ * as `compute_calldata_hash` combines those of two rollups, so that a base rollup of `NUM_KERNELS` kernels has the
+ * calldata hash of the tree of merges of 2-kernel base rollups it stands for (see `BaseRollupSizes`).
+ *
+ * @tparam NUM_KERNELS The number of kernels in the base rollup, a power of 2 of at least 2
+ * @tparam KernelData `PreviousKernelData<NT>`, or a view of it (`PreviousKernelDataView`)
+ * @param kernel_data - the kernels of the base rollup
  * @return std::array<fr, 2>
  */
-std::array<fr, 2> compute_calldata_hash(std::array<fr, 4> calldata_hashes)
+template <size_t NUM_KERNELS, typename KernelData>
+std::array<fr, 2> compute_kernels_calldata_hash(std::array<KernelData, NUM_KERNELS> const& kernel_data)
 {
-    // Generate a 512 bit input from right and left 256 bit hashes
-    constexpr auto num_bytes = 2 * 32;
-    std::array<uint8_t, num_bytes> calldata_hash_input_bytes;
-    for (uint8_t i = 0; i < 4; i++) {
-        auto half = calldata_hashes[i].to_buffer();
-        for (uint8_t j = 0; j < 16; j++) {
-            calldata_hash_input_bytes[i * 16 + j] = half[16 + j];
-        }
+    static_assert(NUM_KERNELS >= 2 && (NUM_KERNELS & (NUM_KERNELS - 1)) == 0,
+                  "The number of kernels per base rollup must be a power of 2");
+
+    // The high and low halves of the calldata hash of each pair of kernels
+    std::array<fr, NUM_KERNELS> calldata_hashes;
+    for (size_t i = 0; i < NUM_KERNELS / 2; i++) {
+        auto const pair_hash =
+            compute_kernel_pair_calldata_hash<KernelData>({ &kernel_data[2 * i], &kernel_data[2 * i + 1] });
+        calldata_hashes[2 * i] = pair_hash[0];
+        calldata_hashes[2 * i + 1] = pair_hash[1];
     }
 
-    // Compute the sha256
-    std::vector<uint8_t> const calldata_hash_input_bytes_vec(calldata_hash_input_bytes.begin(),
-                                                             calldata_hash_input_bytes.end());
-    auto h = sha256::sha256(calldata_hash_input_bytes_vec);
-
-    // Split the hash into two fields, a high and a low
-    std::array<uint8_t, 32> buf_1;
-    std::array<uint8_t, 32> buf_2;
-    for (uint8_t i = 0; i < 16; i++) {
-        buf_1[i] = 0;
-        buf_1[16 + i] = h[i];
-        buf_2[i] = 0;
-        buf_2[16 + i] = h[i + 16];
+    // Combine them layer by layer, in place, as merge rollups would
+    for (size_t num_hashes = NUM_KERNELS / 2; num_hashes > 1; num_hashes /= 2) {
+        for (size_t i = 0; i < num_hashes / 2; i++) {
+            auto const merged_hash = compute_calldata_hash({ calldata_hashes[4 * i],
+                                                             calldata_hashes[4 * i + 1],
+                                                             calldata_hashes[4 * i + 2],
+                                                             calldata_hashes[4 * i + 3] });
+            calldata_hashes[2 * i] = merged_hash[0];
+            calldata_hashes[2 * i + 1] = merged_hash[1];
+        }
     }
-    auto high = fr::serialize_from_buffer(buf_1.data());
-    auto low = fr::serialize_from_buffer(buf_2.data());
 
-    return { high, low };
+    return { calldata_hashes[0], calldata_hashes[1] };
 }
 
+template std::array<fr, 2> compute_kernels_calldata_hash<2>(std::array<abis::PreviousKernelData<NT>, 2> const&);
+template std::array<fr, 2> compute_kernels_calldata_hash<4>(std::array<abis::PreviousKernelData<NT>, 4> const&);
+template std::array<fr, 2> compute_kernels_calldata_hash<8>(std::array<abis::PreviousKernelData<NT>, 8> const&);
+template std::array<fr, 2> compute_kernels_calldata_hash<2>(std::array<abis::PreviousKernelDataView, 2> const&);
+
 /**
  * @brief From two previous rollup data, compute a single calldata hash
  *
@@ -4,13 +4,38 @@
 
 #include "aztec3/utils/circuit_errors.hpp"
 
+#include <span>
+#include <string_view>
+
 using aztec3::circuits::check_membership;
 using aztec3::circuits::root_from_sibling_path;
 
 namespace aztec3::circuits::rollup::components {
 NT::fr calculate_empty_tree_root(size_t depth);
+
+/**
+ * @brief Computes the root of a fixed-depth subtree from its leaves
+ *
+ * @details Hashes bottom-up one layer at a time (each layer as one batch, see `NT::merkle_hash_batch`), overwriting the
+ * front of the (by-value) leaves array with each new layer. A subtree of 2^DEPTH leaves therefore costs 2^DEPTH - 1
+ * hashes, unlike building a MemoryTree and updating it leaf by leaf (which rehashes the whole path for every leaf).
+ *
+ * @tparam DEPTH The depth of the subtree
+ * @param leaves All 2^DEPTH leaves of the subtree, left to right
+ * @return NT::fr The root of the subtree
+ */
+template <size_t DEPTH> NT::fr calculate_subtree_root(std::array<NT::fr, (1UL << DEPTH)> leaves)
+{
+    for (size_t layer_width = leaves.size() / 2; layer_width > 0; layer_width /= 2) {
+        NT::merkle_hash_batch(std::span<NT::fr const>(leaves.data(), 2 * layer_width),
+                              std::span<NT::fr>(leaves.data(), layer_width));
+    }
+    return leaves[0];
+}
+
 std::array<fr, 2> compute_calldata_hash(std::array<fr, 4> calldata_hashes);
-std::array<fr, 2> compute_kernels_calldata_hash(std::array<abis::PreviousKernelData<NT>, 2> kernel_data);
+template <size_t NUM_KERNELS = KERNELS_PER_BASE_ROLLUP, typename KernelData = abis::PreviousKernelData<NT>>
+std::array<fr, 2> compute_kernels_calldata_hash(std::array<KernelData, NUM_KERNELS> const& kernel_data);
 std::array<fr, 2> compute_calldata_hash(std::array<abis::PreviousRollupData<NT>, 2> previous_rollup_data);
 void assert_prev_rollups_follow_on_from_each_other(DummyComposer& composer,
                                                    BaseOrMergeRollupPublicInputs const& left,
@@ -34,7 +59,7 @@ template <size_t N> AppendOnlySnapshot insert_subtree_to_snapshot_tree(DummyComp
                                                                        NT::fr emptySubtreeRoot,
                                                                        NT::fr subtreeRootToInsert,
                                                                        uint8_t subtreeDepth,
-                                                                       std::string const& message)
+                                                                       std::string_view message)
 {
     // TODO: Sanity check len of siblingPath > height of subtree
     // TODO: Ensure height of subtree is correct (eg 3 for commitments, 1 for contracts)
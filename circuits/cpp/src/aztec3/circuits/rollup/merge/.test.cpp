@@ -4,6 +4,8 @@
 
 #include "aztec3/circuits/rollup/merge/init.hpp"
 #include "aztec3/circuits/rollup/test_utils/utils.hpp"
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/sim_batch.hpp"
 
 #include <gtest/gtest.h>
 
@@ -17,6 +19,8 @@ using aztec3::circuits::rollup::test_utils::utils::get_empty_kernel;
 using aztec3::circuits::rollup::test_utils::utils::get_merge_rollup_inputs;
 
 using NT = aztec3::utils::types::NativeTypes;
+using aztec3::utils::CircuitErrorCode;
+using aztec3::utils::SimBatchResult;
 
 using KernelData = aztec3::circuits::abis::PreviousKernelData<NT>;
 
@@ -292,4 +296,39 @@ TEST_F(merge_rollup_tests, native_merge_cbind)
     BaseOrMergeRollupPublicInputs ignored_public_inputs;
     run_cbind(inputs, ignored_public_inputs, false);
 }
+
+TEST_F(merge_rollup_tests, native_merge_batch_cbind)
+{
+    DummyComposer composer = DummyComposer("merge_rollup_tests__native_merge_batch_cbind");
+    std::array<KernelData, 4> const kernels = {
+        get_empty_kernel(), get_empty_kernel(), get_empty_kernel(), get_empty_kernel()
+    };
+    MergeRollupInputs const inputs = get_merge_rollup_inputs(composer, kernels);
+    MergeRollupInputs failing_inputs = inputs;
+    failing_inputs.previous_rollup_data[0].base_or_merge_rollup_public_inputs.rollup_type = 0;
+    failing_inputs.previous_rollup_data[1].base_or_merge_rollup_public_inputs.rollup_type = 1;
+    std::vector<MergeRollupInputs> const batch = { inputs, failing_inputs, inputs };
+
+    // each result of the batch is the one of its own simulation
+    std::vector<SimBatchResult<BaseOrMergeRollupPublicInputs>> expected_results;
+    for (auto const& batch_inputs : batch) {
+        DummyComposer item_composer = DummyComposer("merge_rollup_tests__native_merge_batch_cbind_item");
+        auto const public_inputs = merge_rollup_circuit(item_composer, batch_inputs);
+        expected_results.push_back({ public_inputs, item_composer.get_first_failure() });
+    }
+    ASSERT_EQ(expected_results[0].failure.code, CircuitErrorCode::NO_ERROR);
+    ASSERT_NE(expected_results[1].failure.code, CircuitErrorCode::NO_ERROR);
+    std::vector<uint8_t> expected_results_vec;
+    serialize::write(expected_results_vec, expected_results);
+
+    std::vector<uint8_t> batch_vec;
+    serialize::write(batch_vec, batch);
+    uint8_t const* results_buf = nullptr;
+    size_t const results_size = merge_rollup__sim_batch(batch_vec.data(), &results_buf);
+    ASSERT_EQ(results_size, expected_results_vec.size());
+    for (size_t i = 0; i < results_size; i++) {
+        ASSERT_EQ(results_buf[i], expected_results_vec[i]);
+    }
+    free((void*)results_buf);
+}
 }  // namespace aztec3::circuits::rollup::merge::native_merge_rollup_circuit
@@ -3,6 +3,8 @@
 #include "index.hpp"
 
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/sim_batch.hpp"
+#include "aztec3/utils/write_to_buffer.hpp"
 
 namespace {
 using NT = aztec3::utils::types::NativeTypes;
@@ -10,6 +12,8 @@ using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::abis::BaseOrMergeRollupPublicInputs;
 using aztec3::circuits::abis::MergeRollupInputs;
 using aztec3::circuits::rollup::merge::merge_rollup_circuit;
+using aztec3::utils::simulate_serialized_batch;
+using aztec3::utils::write_to_buffer;
 
 }  // namespace
 #define WASM_EXPORT __attribute__((visibility("default")))
@@ -36,4 +40,31 @@ WASM_EXPORT uint8_t* merge_rollup__sim(uint8_t const* merge_rollup_inputs_buf,
     *merge_rollup_public_inputs_size_out = public_inputs_vec.size();
     return composer.alloc_and_serialize_first_failure();
 }
+
+// Same as base_rollup__sim_into, for merge rollups
+WASM_EXPORT uint8_t* merge_rollup__sim_into(uint8_t const* merge_rollup_inputs_buf,
+                                            uint8_t* public_inputs_buf,
+                                            size_t public_inputs_capacity,
+                                            size_t* public_inputs_size_out)
+{
+    DummyComposer composer = DummyComposer("merge_rollup__sim_into");
+    MergeRollupInputs<NT> merge_rollup_inputs;
+    read(merge_rollup_inputs_buf, merge_rollup_inputs);
+
+    *public_inputs_size_out = write_to_buffer(
+        merge_rollup_circuit(composer, merge_rollup_inputs), public_inputs_buf, public_inputs_capacity);
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Same as base_rollup__sim_batch, for merge rollups
+WASM_EXPORT size_t merge_rollup__sim_batch(uint8_t const* merge_rollup_inputs_buf, uint8_t const** results_buf)
+{
+    return simulate_serialized_batch<MergeRollupInputs<NT>>(
+        "merge_rollup__sim_batch",
+        merge_rollup_inputs_buf,
+        results_buf,
+        [](DummyComposer& composer, MergeRollupInputs<NT> const& merge_rollup_inputs) {
+            return merge_rollup_circuit(composer, merge_rollup_inputs);
+        });
+}
 }  // extern "C"
\ No newline at end of file
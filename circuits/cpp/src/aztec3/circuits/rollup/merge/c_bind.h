@@ -8,4 +8,9 @@ extern "C" {
 WASM_EXPORT uint8_t* merge_rollup__sim(uint8_t const* merge_rollup_inputs_buf,
                                        size_t* merge_rollup_public_inputs_size_out,
                                        uint8_t const** merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* merge_rollup__sim_into(uint8_t const* merge_rollup_inputs_buf,
+                                            uint8_t* public_inputs_buf,
+                                            size_t public_inputs_capacity,
+                                            size_t* public_inputs_size_out);
+WASM_EXPORT size_t merge_rollup__sim_batch(uint8_t const* merge_rollup_inputs_buf, uint8_t const** results_buf);
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <aztec3/circuits/abis/kernel_circuit_public_inputs.hpp>
 #include <aztec3/circuits/mock/mock_kernel_circuit.hpp>
 #include <aztec3/constants.hpp>
+#include <aztec3/utils/sim_batch.hpp>
+#include <aztec3/utils/write_to_buffer.hpp>
 #include <aztec3/utils/types/native_types.hpp>
 
 #include "barretenberg/common/serialize.hpp"
@@ -21,6 +23,8 @@ using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::rollup::native_root_rollup::root_rollup_circuit;
 using aztec3::circuits::rollup::native_root_rollup::RootRollupInputs;
 using aztec3::circuits::rollup::native_root_rollup::RootRollupPublicInputs;
+using aztec3::utils::simulate_serialized_batch;
+using aztec3::utils::write_to_buffer;
 
 }  // namespace
 
@@ -73,6 +77,33 @@ WASM_EXPORT uint8_t* root_rollup__sim(uint8_t const* root_rollup_inputs_buf,
     return composer.alloc_and_serialize_first_failure();
 }
 
+// Same as base_rollup__sim_into, for root rollups
+WASM_EXPORT uint8_t* root_rollup__sim_into(uint8_t const* root_rollup_inputs_buf,
+                                           uint8_t* public_inputs_buf,
+                                           size_t public_inputs_capacity,
+                                           size_t* public_inputs_size_out)
+{
+    RootRollupInputs root_rollup_inputs;
+    read(root_rollup_inputs_buf, root_rollup_inputs);
+
+    DummyComposer composer = DummyComposer("root_rollup__sim_into");
+    *public_inputs_size_out = write_to_buffer(
+        root_rollup_circuit(composer, root_rollup_inputs), public_inputs_buf, public_inputs_capacity);
+    return composer.alloc_and_serialize_first_failure();
+}
+
+// Same as base_rollup__sim_batch, for root rollups
+WASM_EXPORT size_t root_rollup__sim_batch(uint8_t const* root_rollup_inputs_buf, uint8_t const** results_buf)
+{
+    return simulate_serialized_batch<RootRollupInputs>(
+        "root_rollup__sim_batch",
+        root_rollup_inputs_buf,
+        results_buf,
+        [](DummyComposer& composer, RootRollupInputs const& root_rollup_inputs) {
+            return root_rollup_circuit(composer, root_rollup_inputs);
+        });
+}
+
 WASM_EXPORT size_t root_rollup__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length)
 {
     (void)vk_buf;  // unused
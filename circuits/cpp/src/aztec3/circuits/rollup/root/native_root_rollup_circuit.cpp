@@ -33,14 +33,9 @@ namespace aztec3::circuits::rollup::native_root_rollup {
  * @param leaves
  * @return root
  */
-NT::fr calculate_subtree(std::array<NT::fr, NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP> leaves)
+NT::fr calculate_subtree(std::array<NT::fr, NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP> const& leaves)
 {
-    MerkleTree merkle_tree = MerkleTree(L1_TO_L2_MSG_SUBTREE_DEPTH);
-
-    for (size_t i = 0; i < NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP; i++) {
-        merkle_tree.update_element(i, leaves[i]);
-    }
-    return merkle_tree.root();
+    return components::calculate_subtree_root<L1_TO_L2_MSG_SUBTREE_DEPTH>(leaves);
 }
 
 /**
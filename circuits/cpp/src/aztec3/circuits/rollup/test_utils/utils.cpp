@@ -238,8 +238,7 @@ BaseRollupInputs base_rollup_inputs_from_kernels(std::array<KernelData, 2> kerne
         std::move(kernel_data), private_data_tree, contract_tree, public_data_tree, l1_to_l2_messages_tree);
 }
 
-std::array<PreviousRollupData<NT>, 2> get_previous_rollup_data(DummyComposer& composer,
-                                                               std::array<KernelData, 4> kernel_data)
+std::array<BaseRollupInputs, 2> get_base_rollup_inputs(DummyComposer& composer, std::array<KernelData, 4> kernel_data)
 {
     // NOTE: Still assuming that this is first and second. Don't handle more rollups atm
     auto base_rollup_input_1 = base_rollup_inputs_from_kernels({ kernel_data[0], kernel_data[1] });
@@ -283,8 +282,17 @@ std::array<PreviousRollupData<NT>, 2> get_previous_rollup_data(DummyComposer& co
     base_rollup_input_2.new_commitments_subtree_sibling_path =
         get_sibling_path<PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH>(private_data_tree, 8, PRIVATE_DATA_SUBTREE_DEPTH);
 
+    return { base_rollup_input_1, base_rollup_input_2 };
+}
+
+std::array<PreviousRollupData<NT>, 2> get_previous_rollup_data(DummyComposer& composer,
+                                                               std::array<KernelData, 4> kernel_data)
+{
+    auto const base_rollup_inputs = get_base_rollup_inputs(composer, kernel_data);
+    auto base_public_input_1 =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, base_rollup_inputs[0]);
     auto base_public_input_2 =
-        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, base_rollup_input_2);
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, base_rollup_inputs[1]);
 
     PreviousRollupData<NT> const previous_rollup1 = {
         .base_or_merge_rollup_public_inputs = base_public_input_1,
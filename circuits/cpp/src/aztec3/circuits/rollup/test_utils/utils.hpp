@@ -103,6 +103,12 @@ RootRollupInputs get_root_rollup_inputs(utils::DummyComposer& composer,
                                         std::array<KernelData, 4> kernel_data,
                                         std::array<fr, NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP> l1_to_l2_messages);
 
+/**
+ * @brief The inputs of the two consecutive base rollups of a block made of 4 kernels
+ */
+std::array<BaseRollupInputs, 2> get_base_rollup_inputs(utils::DummyComposer& composer,
+                                                       std::array<KernelData, 4> kernel_data);
+
 MergeRollupInputs get_merge_rollup_inputs(utils::DummyComposer& composer, std::array<KernelData, 4> kernel_data);
 
 inline abis::PublicDataUpdateRequest<NT> make_public_data_update_request(fr leaf_index, fr old_value, fr new_value)
@@ -42,6 +42,10 @@ constexpr size_t PRIVATE_DATA_SUBTREE_INCLUSION_CHECK_DEPTH = PRIVATE_DATA_TREE_
 constexpr size_t NULLIFIER_SUBTREE_DEPTH = 3;
 constexpr size_t NULLIFIER_SUBTREE_INCLUSION_CHECK_DEPTH = NULLIFIER_TREE_HEIGHT - NULLIFIER_SUBTREE_DEPTH;
 
+// The subtree depths above are those of a base rollup of KERNELS_PER_BASE_ROLLUP kernels. The depths for other
+// (power of 2) numbers of kernels are derived by abis::BaseRollupSizes.
+constexpr size_t KERNELS_PER_BASE_ROLLUP = 2;
+
 // NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP must equal 2^L1_TO_L2_MSG_SUBTREE_DEPTH for subtree insertions.
 constexpr size_t L1_TO_L2_MSG_SUBTREE_DEPTH = 4;
 constexpr size_t NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP = 16;
@@ -29,6 +29,9 @@ enum CircuitErrorCode : uint16_t {
     PRIVATE_KERNEL__PRIVATE_CALL_STACK_EMPTY = 2015,
     PRIVATE_KERNEL__KERNEL_PROOF_CONTAINS_RECURSIVE_PROOF = 2016,
     PRIVATE_KERNEL__USER_INTENT_MISMATCH_BETWEEN_TX_REQUEST_AND_CALL_STACK_ITEM = 2017,
+    PRIVATE_KERNEL__UNKNOWN_SESSION = 2018,
+    PRIVATE_KERNEL__UNKNOWN_SIMULATION = 2019,
+    PRIVATE_KERNEL__CIRCUIT_OUTPUTS_MISMATCH_SIMULATION = 2020,
 
     // Public kernel related errors
     PUBLIC_KERNEL_CIRCUIT_FAILED = 3000,
@@ -78,6 +81,7 @@ enum CircuitErrorCode : uint16_t {
     MEMBERSHIP_CHECK_FAILED = 7008,
 
     ROOT_CIRCUIT_FAILED = 8000,
+    ROOT__INVALID_NUMBER_OF_BASE_ROLLUPS = 8001,
 };
 
 struct CircuitError {
@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -14,21 +16,44 @@ class DummyComposer {
     std::vector<CircuitError> failure_msgs;
     // method that created this composer instance. Useful for logging.
     std::string method_name;
+    // stop at the first failure rather than collecting all of them, see `should_stop()`
+    bool fail_fast = false;
 
-    explicit DummyComposer(std::string method_name) : method_name(std::move(method_name)) {}
+    explicit DummyComposer(std::string method_name, bool fail_fast = false)
+        : method_name(std::move(method_name)), fail_fast(fail_fast)
+    {}
 
-    void do_assert(bool const& assertion, std::string const& msg, CircuitErrorCode error_code)
+    void do_assert(bool const& assertion, std::string_view msg, CircuitErrorCode error_code)
     {
-        if (!assertion) {
-#ifdef __wasm__
-            info("Error(", error_code, "): ", msg);
-#endif
-            failure_msgs.push_back(CircuitError{ error_code, msg });
+        if (!assertion && !should_stop()) {
+            add_failure(std::string(msg), error_code);
+        }
+    }
+
+    /**
+     * Same as above, but the failure message is only built (by calling `make_msg`) if the assertion fails.
+     * Use it whenever the message is formatted from values, e.g.
+     * `composer.do_assert(a == b, [&] { return format("a = ", a, " expected ", b); }, error_code)`,
+     * so that the passing path does not pay for string allocations and field formatting.
+     */
+    template <typename MessageBuilder>
+        requires std::is_invocable_r_v<std::string, MessageBuilder const&>
+    void do_assert(bool const& assertion, MessageBuilder const& make_msg, CircuitErrorCode error_code)
+    {
+        if (!assertion && !should_stop()) {
+            add_failure(make_msg(), error_code);
         }
     }
 
     [[nodiscard]] bool failed() const { return !failure_msgs.empty(); }
 
+    /**
+     * Whether a fail-fast composer has already failed. Only the first failure is ever reported, so native circuits
+     * check this between their stages and return early rather than spend the rest of their hashing on an input that
+     * is already rejected. Any later failed assertion is not recorded. Always false if `fail_fast` is not set.
+     */
+    [[nodiscard]] bool should_stop() const { return fail_fast && failed(); }
+
     CircuitError get_first_failure()
     {
         if (failed()) {
@@ -71,6 +96,15 @@ class DummyComposer {
         memcpy(raw_failure_buf, (void*)circuit_failure_vec.data(), circuit_failure_vec.size());
         return raw_failure_buf;
     }
+
+  private:
+    void add_failure(std::string msg, CircuitErrorCode error_code)
+    {
+#ifdef __wasm__
+        info("Error(", error_code, "): ", msg);
+#endif
+        failure_msgs.push_back(CircuitError{ error_code, std::move(msg) });
+    }
 };
 
 }  // namespace aztec3::utils
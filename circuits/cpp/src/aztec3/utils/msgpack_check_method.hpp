@@ -0,0 +1,76 @@
+#pragma once
+#include "types/msgpack_packed_fr.hpp"
+
+#include <barretenberg/serialize/msgpack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace aztec3::utils {
+
+// The field a value of a msgpack method stands for: the value itself, or the array a `msgpack_packed` proxy refers to
+template <typename T> T const& msgpack_field(T const& value)
+{
+    return value;
+}
+template <size_t N>
+std::array<barretenberg::fr, N> const& msgpack_field(types::PackedFrArray<N> const& value)
+{
+    return value.elements;
+}
+
+inline size_t _align_msgpack_field_offset(size_t offset, size_t alignment)  // NOLINT
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+inline void _check_msgpack_fields(std::string& result, uintptr_t object, size_t& offset)  // NOLINT
+{
+    // base case
+    (void)result;  // unused
+    (void)object;  // unused
+    (void)offset;  // unused
+}
+template <typename Value, typename... Rest>
+void _check_msgpack_fields(std::string& result,  // NOLINT
+                           uintptr_t object,
+                           size_t& offset,
+                           std::string const& name,
+                           Value const& value,
+                           Rest const&... rest)
+{
+    auto const& field = msgpack_field(value);
+    using Field = std::remove_cvref_t<decltype(field)>;
+    offset = _align_msgpack_field_offset(offset, alignof(Field));
+    if (result.empty() && reinterpret_cast<uintptr_t>(&field) != object + offset) {
+        result = "Field " + name + " is not the next field of the object.";
+    }
+    offset += sizeof(Field);
+    _check_msgpack_fields(result, object, offset, rest...);
+}
+
+/**
+ * @brief Check that the msgpack method of `object` names each of its fields once, in the order they are declared.
+ *
+ * @details As `msgpack::check_msgpack_method`, which checks that the values of the method span the object, but a
+ * `msgpack_packed` proxy (which lives outside the object) stands for the array it refers to.
+ *
+ * @return An empty string if the method checks out, else what is wrong with it.
+ */
+template <msgpack_concepts::HasMsgPack T> std::string check_msgpack_method(T const& object)
+{
+    std::string result;
+    size_t offset = 0;
+    const_cast<T&>(object).msgpack([&](auto&... names_and_fields) {  // NOLINT
+        _check_msgpack_fields(result, reinterpret_cast<uintptr_t>(&object), offset, names_and_fields...);
+    });
+    if (result.empty() && _align_msgpack_field_offset(offset, alignof(T)) != sizeof(T)) {
+        result = "The fields do not cover the object.";
+    }
+    return result;
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <barretenberg/common/assert.hpp>
+#include <barretenberg/common/serialize.hpp>
+#include <barretenberg/ecc/curves/bn254/fr.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Serialized sizes known at compile time, and encoding at fixed offsets of a buffer of that size.
+ *
+ * `write` to a `std::vector<uint8_t>` grows the vector once per field. A type whose serialization always has the same
+ * size (made of fields, integers and arrays of them, without vectors) can instead be encoded into a buffer sized once,
+ * through the `write(uint8_t*& it, ...)` overloads which write each field at the next offset.
+ *
+ * A struct opts in by specializing `SerializedSize` for its native type, next to its `read` and `write` functions,
+ * with the types of the fields it writes. Structs holding an aggregation object or a verification key (e.g.
+ * `KernelCircuitPublicInputs`, `BaseOrMergeRollupPublicInputs`) are not of a fixed size.
+ */
+namespace aztec3::utils {
+
+/**
+ * @brief `value` is the serialized size of `T`, for types whose serialization always has the same size. Other types
+ * have no `value`.
+ */
+template <typename T> struct SerializedSize {};
+
+template <typename T> concept FixedSizeSerializable = requires { SerializedSize<T>::value; };
+
+/**
+ * @brief The serialized size of a struct written as its `Fields` one after the other
+ */
+template <FixedSizeSerializable... Fields>
+struct SerializedSizeOf : std::integral_constant<size_t, (SerializedSize<Fields>::value + ... + 0)> {};
+
+template <typename T>
+    requires std::is_integral_v<T>
+struct SerializedSize<T> : std::integral_constant<size_t, sizeof(T)> {};
+
+// written as its 4 limbs, out of Montgomery form
+template <> struct SerializedSize<barretenberg::fr> : std::integral_constant<size_t, 32> {};
+
+template <FixedSizeSerializable T, size_t N>
+struct SerializedSize<std::array<T, N>> : std::integral_constant<size_t, N * SerializedSize<T>::value> {};
+
+template <FixedSizeSerializable T> constexpr size_t serialized_size()
+{
+    return SerializedSize<T>::value;
+}
+
+/**
+ * @brief Serialize `value` into `buf`, which is exactly its serialized size
+ *
+ * @details The `write(uint8_t*& it, ...)` overloads don't check where the buffer ends, so a `SerializedSize` that
+ * disagrees with the fields a struct writes overruns `buf`. The abis tests check the size of each specialization
+ * against what its `write` writes.
+ */
+template <FixedSizeSerializable T> void write_fixed(std::span<uint8_t, serialized_size<T>()> buf, T const& value)
+{
+    using serialize::write;
+
+    uint8_t* it = buf.data();
+    write(it, value);
+    ASSERT(it == buf.data() + buf.size());
+}
+
+/**
+ * @brief Same as `write(buf, value)`, growing `buf` once by the serialized size of `value`
+ */
+template <FixedSizeSerializable T> void append_fixed(std::vector<uint8_t>& buf, T const& value)
+{
+    auto const offset = buf.size();
+    buf.resize(offset + serialized_size<T>());
+    write_fixed<T>(std::span<uint8_t, serialized_size<T>()>(buf.data() + offset, serialized_size<T>()), value);
+}
+
+}  // namespace aztec3::utils
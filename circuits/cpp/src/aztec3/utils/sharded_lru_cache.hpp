@@ -0,0 +1,153 @@
+#pragma once
+
+#include <barretenberg/serialize/msgpack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace aztec3::utils {
+
+/**
+ * @brief Counters of a `ShardedLruCache`, summed over its shards
+ *
+ * @details 32-bit, as the typescript bindings map no wider integer: the hit, miss and eviction counts wrap around.
+ */
+struct LruCacheStats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t size = 0;
+    uint32_t capacity = 0;
+
+    MSGPACK_FIELDS(hits, misses, evictions, size, capacity);
+    bool operator==(LruCacheStats const&) const = default;
+};
+
+/**
+ * @brief A bounded map from keys to values computed from them, evicting the least recently used entries when full
+ *
+ * @details Entries are split between `NUM_SHARDS` shards by the hash of their key, each with its own lock, so that
+ * threads looking up different keys rarely wait for each other. Each shard holds up to `capacity / NUM_SHARDS`
+ * entries. Values are computed outside of the lock: two threads missing the same key may both compute it.
+ *
+ * @tparam Hash A hash of `Key`, also used to pick the shard of a key
+ */
+template <typename Key, typename Value, typename Hash, size_t NUM_SHARDS = 16> class ShardedLruCache {
+  public:
+    explicit ShardedLruCache(size_t capacity) { set_capacity(capacity); }
+
+    /**
+     * @brief The value of `key`, calling `compute()` for it only if it isn't cached
+     */
+    template <typename Compute> Value get_or_compute(Key const& key, Compute const& compute)
+    {
+        auto const key_hash = Hash{}(key);
+        Shard& shard = shards[key_hash % NUM_SHARDS];
+        {
+#ifndef NO_MULTITHREADING
+            std::lock_guard<std::mutex> const lock(shard.mutex);
+#endif
+            auto const it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                shard.hits++;
+                // move the entry to the front, as the most recently used one
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                return it->second->second;
+            }
+            shard.misses++;
+        }
+
+        Value value = compute();
+
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(shard.mutex);
+#endif
+        if (shard.capacity > 0 && !shard.index.contains(key)) {
+            shard.entries.emplace_front(key, value);
+            shard.index.emplace(key, shard.entries.begin());
+            shard.evict_to_capacity();
+        }
+        return value;
+    }
+
+    /**
+     * @brief Change the number of entries cached, evicting the least recently used ones of a shard that is too large
+     */
+    void set_capacity(size_t capacity)
+    {
+        for (auto& shard : shards) {
+#ifndef NO_MULTITHREADING
+            std::lock_guard<std::mutex> const lock(shard.mutex);
+#endif
+            shard.capacity = (capacity + NUM_SHARDS - 1) / NUM_SHARDS;
+            shard.evict_to_capacity();
+        }
+    }
+
+    LruCacheStats get_stats()
+    {
+        LruCacheStats stats;
+        for (auto& shard : shards) {
+#ifndef NO_MULTITHREADING
+            std::lock_guard<std::mutex> const lock(shard.mutex);
+#endif
+            stats.hits += shard.hits;
+            stats.misses += shard.misses;
+            stats.evictions += shard.evictions;
+            stats.size += static_cast<uint32_t>(shard.entries.size());
+            stats.capacity += static_cast<uint32_t>(shard.capacity);
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Remove every entry, and reset the counters
+     */
+    void clear()
+    {
+        for (auto& shard : shards) {
+#ifndef NO_MULTITHREADING
+            std::lock_guard<std::mutex> const lock(shard.mutex);
+#endif
+            shard.entries.clear();
+            shard.index.clear();
+            shard.hits = 0;
+            shard.misses = 0;
+            shard.evictions = 0;
+        }
+    }
+
+  private:
+    struct Shard {
+        // most recently used first
+        std::list<std::pair<Key, Value>> entries;
+        std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator, Hash> index;
+        size_t capacity = 0;
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t evictions = 0;
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+
+        void evict_to_capacity()
+        {
+            while (entries.size() > capacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+                evictions++;
+            }
+        }
+    };
+
+    std::array<Shard, NUM_SHARDS> shards;
+};
+
+}  // namespace aztec3::utils
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <barretenberg/srs/reference_string/reference_string.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace aztec3::utils {
+
+/**
+ * @brief A reference string factory handing out the reference strings of another factory, which are only loaded once
+ *
+ * @details Factories loading the reference string from a file (or from the host, in wasm) read and parse its points
+ * again on every request. Composers sharing this factory share the largest prover reference string requested so far
+ * instead (a larger one serves any smaller circuit), so only requests for a larger circuit than any before load it.
+ * Share it by `std::shared_ptr`: it stays alive for as long as any composer uses it.
+ */
+class SharedReferenceStringFactory : public proof_system::ReferenceStringFactory {
+  public:
+    explicit SharedReferenceStringFactory(std::shared_ptr<proof_system::ReferenceStringFactory> factory)
+        : factory(std::move(factory))
+    {}
+
+    std::shared_ptr<proof_system::ProverReferenceString> get_prover_crs(size_t degree) override
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(mutex);
+#endif
+        if (!prover_crs || prover_crs->get_monomial_size() < degree) {
+            prover_crs = factory->get_prover_crs(degree);
+        }
+        return prover_crs;
+    }
+
+    std::shared_ptr<proof_system::VerifierReferenceString> get_verifier_crs() override
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> const lock(mutex);
+#endif
+        if (!verifier_crs) {
+            verifier_crs = factory->get_verifier_crs();
+        }
+        return verifier_crs;
+    }
+
+  private:
+    std::shared_ptr<proof_system::ReferenceStringFactory> factory;
+    std::shared_ptr<proof_system::ProverReferenceString> prover_crs;
+    std::shared_ptr<proof_system::VerifierReferenceString> verifier_crs;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+};
+
+}  // namespace aztec3::utils
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "circuit_errors.hpp"
+#include "dummy_composer.hpp"
+
+#include <barretenberg/common/serialize.hpp>
+#include <barretenberg/common/thread.hpp>
+#include <barretenberg/serialize/msgpack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Batched native simulation, for the `*__sim_batch` cbinds.
+ *
+ * Simulating inputs one `*__sim` call at a time pays, for every input, a crossing of the wasm boundary and a copy of
+ * its outputs. A batch simulates a whole vector of inputs in one call, in parallel on native builds (`parallel_for`
+ * runs sequentially when built with NO_MULTITHREADING, as for wasm).
+ */
+namespace aztec3::utils {
+
+/**
+ * @brief The outcome of the simulation of one input of a batch
+ */
+template <typename PublicInputs> struct SimBatchResult {
+    PublicInputs public_inputs{};
+    // `CircuitError::no_error()` if the simulation passed
+    CircuitError failure = CircuitError::no_error();
+
+    // for serialization, update with new fields
+    MSGPACK_FIELDS(public_inputs, failure);
+};
+
+template <typename PublicInputs> void read(uint8_t const*& it, SimBatchResult<PublicInputs>& obj)
+{
+    using serialize::read;
+
+    read(it, obj.public_inputs);
+    read(it, obj.failure);
+};
+
+template <typename PublicInputs> void write(std::vector<uint8_t>& buf, SimBatchResult<PublicInputs> const& obj)
+{
+    using serialize::write;
+
+    write(buf, obj.public_inputs);
+    write(buf, obj.failure);
+};
+
+/**
+ * @brief Simulate every input of `inputs` with its own composer
+ *
+ * @param simulate The native circuit, called as `simulate(composer, input)`. It is called from several threads at once
+ * on native builds.
+ */
+template <typename Inputs, typename Simulate>
+auto simulate_batch(std::string const& method_name, std::vector<Inputs> const& inputs, Simulate const& simulate)
+{
+    using PublicInputs = std::decay_t<std::invoke_result_t<Simulate const&, DummyComposer&, Inputs const&>>;
+    std::vector<SimBatchResult<PublicInputs>> results(inputs.size());
+    parallel_for(inputs.size(), [&](size_t i) {
+        DummyComposer composer = DummyComposer(method_name);
+        results[i].public_inputs = simulate(composer, inputs[i]);
+        results[i].failure = composer.get_first_failure();
+    });
+    return results;
+}
+
+/**
+ * @brief Read a vector of inputs from `inputs_buf` (its length first, as serialized by `write`), simulate them (see
+ * `simulate_batch`) and write the vector of their results to a buffer allocated for `results_buf`
+ *
+ * @return The size of the results buffer
+ */
+template <typename Inputs, typename Simulate>
+size_t simulate_serialized_batch(std::string const& method_name,
+                                 uint8_t const* inputs_buf,
+                                 uint8_t const** results_buf,
+                                 Simulate const& simulate)
+{
+    using serialize::read;
+    using serialize::write;
+
+    std::vector<Inputs> inputs;
+    read(inputs_buf, inputs);
+
+    auto const results = simulate_batch(method_name, inputs, simulate);
+
+    std::vector<uint8_t> results_vec;
+    write(results_vec, results);
+    auto* raw_results_buf = (uint8_t*)malloc(results_vec.size());
+    memcpy(raw_results_buf, (void*)results_vec.data(), results_vec.size());
+    *results_buf = raw_results_buf;
+    return results_vec.size();
+}
+
+}  // namespace aztec3::utils
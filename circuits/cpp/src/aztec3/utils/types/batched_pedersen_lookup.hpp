@@ -0,0 +1,98 @@
+#pragma once
+#include <barretenberg/common/throw_or_abort.hpp>
+#include <barretenberg/crypto/pedersen_hash/pedersen_lookup.hpp>
+#include <barretenberg/ecc/curves/bn254/fr.hpp>
+#include <barretenberg/ecc/curves/grumpkin/grumpkin.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+/**
+ * Batched native Merkle hashing.
+ *
+ * `crypto::pedersen_hash::lookup::hash_multiple` is a Merkle-Damgard chain: starting from the x coordinate of an
+ * initial point, it absorbs each input with `hash_pair` and finally the number of inputs, normalising the point of
+ * every step to affine form (one field inversion) to read its x coordinate. The chains of different pairs are
+ * independent, so here each step is done in projective form for a whole batch of pairs, and all of its points are
+ * normalised with a single batched inversion: three inversions per batch rather than three per pair. Nothing is
+ * allocated: the hashes are written to a span given by the caller, which may overwrite the pairs in place.
+ */
+namespace aztec3::utils::types::batched_pedersen_lookup {
+
+using fr = barretenberg::fr;
+using element = grumpkin::g1::element;
+
+// the number of pairs whose points share an inversion; their points are kept on the stack (96 bytes each)
+constexpr size_t BATCH_SIZE = 64;
+
+/**
+ * @brief The chain of `hash_multiple({ left, right }, 0)` for every pair, one step at a time over each batch of pairs
+ *
+ * @details The pairs of a batch are all read before any of their parents is written, and each batch's parents come
+ * before its children, so `parents` may be the front of `children`.
+ *
+ * @param children The (left, right) pairs, flattened
+ * @param parents Where to write the hash of each pair, half the size of `children`
+ */
+inline void hash_pairs_batched(std::span<fr const> children, std::span<fr> parents)
+{
+    using crypto::pedersen_hash::lookup::hash_single;
+    // the chain of hash index 0 starts from the x coordinate of the generator, and always absorbs a length of 2
+    static element const initial_point = hash_single(grumpkin::g1::affine_one.x, false);
+    static element const length_point = hash_single(fr(2), true);
+
+    std::array<element, BATCH_SIZE> points;
+    for (size_t start = 0; start < parents.size(); start += BATCH_SIZE) {
+        size_t const count = std::min(BATCH_SIZE, parents.size() - start);
+        fr const* const pairs = children.data() + 2 * start;
+        // each step normalises the points of the whole batch with one shared inversion
+        auto const step = [&](auto const& next_point) {
+            for (size_t i = 0; i < count; ++i) {
+                points[i] = next_point(i);
+            }
+            element::batch_normalize(points.data(), count);
+        };
+        step([&](size_t i) { return initial_point + hash_single(pairs[2 * i], true); });
+        step([&](size_t i) { return hash_single(points[i].x, false) + hash_single(pairs[2 * i + 1], true); });
+        step([&](size_t i) { return hash_single(points[i].x, false) + length_point; });
+        for (size_t i = 0; i < count; ++i) {
+            parents[start + i] = points[i].x;
+        }
+    }
+}
+
+/**
+ * @brief Write `crypto::pedersen_hash::lookup::hash_multiple({ left, right }, 0)` of every (left, right) pair of
+ * `children` to `parents`
+ *
+ * @details `hash_pairs_batched` follows the steps of `hash_multiple`, which barretenberg keeps to itself. It is checked
+ * against `hash_multiple` once per process (and exhaustively by the abis tests), and aborts should they ever disagree.
+ *
+ * @param children The (left, right) pairs, flattened
+ * @param parents Where to write the hash of each pair, half the size of `children`; may be the front of `children`
+ */
+inline void merkle_hash_batch(std::span<fr const> children, std::span<fr> parents)
+{
+    static bool const batching_matches = [] {
+        std::array<fr, 6> const samples = { fr(1), fr(2), fr(0), fr(0), fr(-1), fr(uint256_t(1) << 253) };
+        std::array<fr, 3> hashes;
+        hash_pairs_batched(samples, hashes);
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            if (hashes[i] != crypto::pedersen_hash::lookup::hash_multiple({ samples[2 * i], samples[2 * i + 1] }, 0)) {
+                return false;
+            }
+        }
+        return true;
+    }();
+    if (!batching_matches) {
+        throw_or_abort("batched_pedersen_lookup: hash_pairs_batched disagrees with lookup::hash_multiple");
+    }
+    if (children.size() != 2 * parents.size()) {
+        throw_or_abort("batched_pedersen_lookup: there must be two children per parent");
+    }
+    hash_pairs_batched(children, parents);
+}
+
+}  // namespace aztec3::utils::types::batched_pedersen_lookup
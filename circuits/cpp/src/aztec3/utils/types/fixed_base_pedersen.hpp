@@ -0,0 +1,170 @@
+#pragma once
+#include <barretenberg/crypto/generators/generator_data.hpp>
+#include <barretenberg/crypto/pedersen_commitment/pedersen.hpp>
+#include <barretenberg/ecc/curves/bn254/fr.hpp>
+#include <barretenberg/ecc/curves/grumpkin/grumpkin.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+#ifdef COUNT_PEDERSEN_COMPRESSIONS
+#include <atomic>
+#endif
+
+/**
+ * Native Pedersen compression with precomputed fixed-base tables.
+ *
+ * `crypto::pedersen_commitment::compress_native` commits to each input with a ladder of 2-bit steps (~127 point
+ * additions per input) and copies its inputs into vectors. A commitment to an input is linear in the bits of the
+ * input, so for every generator (hash index and sub-index) we precompute, once, the commitments to each 4-bit window
+ * value at each window position. A commitment then takes a table lookup and at most one mixed addition per window
+ * (64 per input), and allocates nothing once the tables of its generators are built.
+ *
+ * Tables are built on first use, so only the generators aztec3 actually hashes with get one (64 KiB each). Each is
+ * built once, and later lookups of the generators aztec3 hashes with take no lock (see `get_table`).
+ */
+namespace aztec3::utils::types::fixed_base_pedersen {
+
+using fr = barretenberg::fr;
+using affine_element = grumpkin::g1::affine_element;
+using element = grumpkin::g1::element;
+
+constexpr size_t WINDOW_BITS = 4;
+constexpr size_t WINDOW_SIZE = 1UL << WINDOW_BITS;
+// inputs are canonical field elements, below the modulus, so the bits above NUM_BITS are always zero
+constexpr size_t NUM_BITS = 254;
+constexpr size_t NUM_WINDOWS = (NUM_BITS + WINDOW_BITS - 1) / WINDOW_BITS;
+
+/**
+ * @brief `points[w][d]` is the commitment to `d * 2^(WINDOW_BITS * w)` with a given generator, for any non-zero window
+ * value `d` of an input below the modulus
+ */
+struct Table {
+    std::array<std::array<affine_element, WINDOW_SIZE>, NUM_WINDOWS> points;
+};
+
+inline std::unique_ptr<Table> build_table(crypto::generators::generator_index_t const& generator_index)
+{
+    // the commitment to each single bit, from which every window value's commitment is summed
+    std::array<element, NUM_BITS> bit_points;
+    for (size_t bit = 0; bit < NUM_BITS; ++bit) {
+        bit_points[bit] =
+            crypto::pedersen_commitment::commit_native({ { fr(uint256_t(1) << bit), generator_index } });
+    }
+
+    std::vector<std::pair<size_t, size_t>> entries;
+    std::vector<element> entry_points;
+    for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+        std::array<element, WINDOW_SIZE> window_points;
+        for (size_t value = 1; value < WINDOW_SIZE; ++value) {
+            // values with bits at or above NUM_BITS (only in the last window) are never looked up
+            if (window * WINDOW_BITS + static_cast<size_t>(std::bit_width(value)) > NUM_BITS) {
+                continue;
+            }
+            // the value without its lowest bit has a smaller value, so its commitment is already computed
+            size_t const bit = window * WINDOW_BITS + static_cast<size_t>(std::countr_zero(value));
+            size_t const rest = value & (value - 1);
+            window_points[value] = rest == 0 ? bit_points[bit] : window_points[rest] + bit_points[bit];
+            entries.emplace_back(window, value);
+            entry_points.push_back(window_points[value]);
+        }
+    }
+    element::batch_normalize(entry_points.data(), entry_points.size());
+
+    auto table = std::make_unique<Table>();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        auto const& [window, value] = entries[i];
+        table->points[window][value] = affine_element(entry_points[i].x, entry_points[i].y);
+    }
+    return table;
+}
+
+// generators with a hash index and sub-index below these bounds (all the ones aztec3 hashes with) have a slot of their
+// own, so that looking up their table after it is built takes no lock
+constexpr size_t MAX_SLOT_HASH_INDICES = 64;
+constexpr size_t MAX_SLOT_SUB_INDICES = 256;
+
+struct TableSlot {
+#ifndef NO_MULTITHREADING
+    std::once_flag built;
+#endif
+    std::unique_ptr<Table> table;
+};
+
+/**
+ * @brief The table of the generator `generator_index`, built the first time it is requested
+ */
+inline Table const& get_table(crypto::generators::generator_index_t const& generator_index)
+{
+    if (generator_index.index < MAX_SLOT_HASH_INDICES && generator_index.sub_index < MAX_SLOT_SUB_INDICES) {
+        // constant-initialised, so the slots exist before any (static initialisation time) hash
+        static std::array<std::array<TableSlot, MAX_SLOT_SUB_INDICES>, MAX_SLOT_HASH_INDICES> slots;
+        auto& slot = slots[generator_index.index][generator_index.sub_index];
+#ifndef NO_MULTITHREADING
+        std::call_once(slot.built, [&] { slot.table = build_table(generator_index); });
+#else
+        if (!slot.table) {
+            slot.table = build_table(generator_index);
+        }
+#endif
+        return *slot.table;
+    }
+
+    // map nodes are never erased, so references to the tables outlive the lock
+    static std::map<std::pair<size_t, size_t>, std::unique_ptr<Table>> tables;
+#ifndef NO_MULTITHREADING
+    static std::mutex tables_mutex;
+    std::lock_guard<std::mutex> const lock(tables_mutex);
+#endif
+    auto& table = tables[{ generator_index.index, generator_index.sub_index }];
+    if (!table) {
+        table = build_table(generator_index);
+    }
+    return *table;
+}
+
+#ifdef COUNT_PEDERSEN_COMPRESSIONS
+/**
+ * @brief The number of `compress` calls made by this process, for benchmarks to count the hashes of a circuit. Only
+ * counted in builds configured with COUNT_PEDERSEN_COMPRESSIONS.
+ */
+inline std::atomic<size_t> num_compressions = 0;
+#endif
+
+/**
+ * @brief Same as `crypto::pedersen_commitment::compress_native(inputs, hash_index)`, with the fixed-base tables
+ */
+inline fr compress(std::span<fr const> inputs, size_t hash_index)
+{
+#ifdef COUNT_PEDERSEN_COMPRESSIONS
+    num_compressions.fetch_add(1, std::memory_order_relaxed);
+#endif
+    element accumulator = grumpkin::g1::point_at_infinity;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        Table const& table = get_table({ .index = hash_index, .sub_index = i });
+        fr const input = inputs[i].from_montgomery_form();
+        for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+            size_t const bit = window * WINDOW_BITS;
+            auto const value = static_cast<size_t>((input.data[bit / 64] >> (bit % 64)) & (WINDOW_SIZE - 1));
+            if (value != 0) {
+                accumulator += table.points[window][value];
+            }
+        }
+    }
+    // as in `commit_native`, the point at infinity is (0, 0)
+    if (accumulator.is_point_at_infinity()) {
+        return fr(0);
+    }
+    return affine_element(accumulator).x;
+}
+
+}  // namespace aztec3::utils::types::fixed_base_pedersen
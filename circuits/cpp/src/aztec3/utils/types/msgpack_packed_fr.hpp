@@ -0,0 +1,133 @@
+#pragma once
+#include <barretenberg/ecc/curves/bn254/fr.hpp>
+#include <barretenberg/serialize/msgpack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+
+/**
+ * Msgpack encoding of an array of fr as one `bin` of its contiguous elements.
+ *
+ * By default msgpack packs each fr of an array as its own `bin32`: a sibling path of PUBLIC_DATA_TREE_HEIGHT elements
+ * costs as many element headers, and as many dispatches to unpack. A field wrapped by `msgpack_packed` in the msgpack
+ * method of its struct is instead packed as a single `bin` of 32 * N bytes, each element big-endian out of Montgomery
+ * form as `fr` packs itself, and unpacked with a single check of the size of the `bin`.
+ *
+ * The msgpack schema of a wrapped field is `["packed_array", [<fr schema>, N]]`, so that the typescript schema compiler
+ * splits the `bin` back into fields. `std::array<fr, N>` itself keeps the default encoding of msgpack.
+ */
+namespace aztec3::utils::types {
+
+namespace msgpack_packed_fr {
+
+using fr = barretenberg::fr;
+
+constexpr size_t FR_SIZE = 32;
+
+template <typename Stream> void pack(msgpack::packer<Stream>& packer, fr const* elements, size_t num_elements)
+{
+    packer.pack_bin(static_cast<uint32_t>(num_elements * FR_SIZE));
+    for (size_t i = 0; i < num_elements; i++) {
+        std::array<uint8_t, FR_SIZE> element_buf;
+        fr::serialize_to_buffer(elements[i], element_buf.data());
+        packer.pack_bin_body(reinterpret_cast<char const*>(element_buf.data()), FR_SIZE);
+    }
+}
+
+inline void unpack(msgpack::object const& object, fr* elements, size_t num_elements)
+{
+    if (object.type != msgpack::type::BIN || object.via.bin.size != num_elements * FR_SIZE) {
+#ifdef __cpp_exceptions
+        throw msgpack::type_error();
+#else
+        std::abort();
+#endif
+    }
+    auto const* it = reinterpret_cast<uint8_t const*>(object.via.bin.ptr);
+    for (size_t i = 0; i < num_elements; i++) {
+        elements[i] = fr::serialize_from_buffer(it + i * FR_SIZE);
+    }
+}
+
+}  // namespace msgpack_packed_fr
+
+/**
+ * @brief A reference to an `std::array<barretenberg::fr, N>`, which msgpack packs as one `bin` of its elements.
+ */
+template <size_t N> struct PackedFrArray {
+    std::array<barretenberg::fr, N>& elements;
+
+    bool operator==(PackedFrArray<N> const& other) const { return elements == other.elements; }
+};
+
+template <size_t N> std::ostream& operator<<(std::ostream& os, PackedFrArray<N> const& packed)
+{
+    return os << packed.elements;
+}
+
+// found by argument-dependent lookup, through the namespace of PackedFrArray
+template <size_t N> void msgpack_schema_pack(MsgpackSchemaPacker& packer, PackedFrArray<N> const&)
+{
+    packer.pack_array(2);
+    packer.pack("packed_array");
+    packer.pack_array(2);
+    packer.pack_schema(barretenberg::fr{});
+    packer.pack(N);
+}
+
+/**
+ * @brief A field of a msgpack method, as is.
+ */
+template <typename T> T& msgpack_packed(T& field)
+{
+    return field;
+}
+
+/**
+ * @brief An array of native fr of a msgpack method, packed as one `bin` of its elements.
+ */
+template <size_t N> PackedFrArray<N> msgpack_packed(std::array<barretenberg::fr, N>& field)
+{
+    return PackedFrArray<N>{ field };
+}
+
+/**
+ * @brief Call the `pack_fn` of a msgpack method with its alternating names and fields, some of them `msgpack_packed`.
+ *
+ * @details `pack_fn` takes lvalues: the proxies of `msgpack_packed` are named here, and live until it returns.
+ */
+template <typename PackFn, typename... Args> void msgpack_fields(PackFn& pack_fn, Args&&... names_and_fields)
+{
+    pack_fn(names_and_fields...);
+}
+
+}  // namespace aztec3::utils::types
+
+namespace msgpack {
+MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS)
+{
+    namespace adaptor {
+
+    template <std::size_t N> struct pack<aztec3::utils::types::PackedFrArray<N>> {
+        template <typename Stream>
+        packer<Stream>& operator()(packer<Stream>& o, aztec3::utils::types::PackedFrArray<N> const& value) const
+        {
+            aztec3::utils::types::msgpack_packed_fr::pack(o, value.elements.data(), N);
+            return o;
+        }
+    };
+
+    template <std::size_t N> struct convert<aztec3::utils::types::PackedFrArray<N>> {
+        object const& operator()(object const& o, aztec3::utils::types::PackedFrArray<N>& value) const
+        {
+            aztec3::utils::types::msgpack_packed_fr::unpack(o, value.elements.data(), N);
+            return o;
+        }
+    };
+
+    }  // namespace adaptor
+}  // MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS)
+}  // namespace msgpack
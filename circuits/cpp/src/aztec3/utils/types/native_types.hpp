@@ -1,4 +1,8 @@
 #pragma once
+#include "batched_pedersen_lookup.hpp"
+#include "fixed_base_pedersen.hpp"
+#include "msgpack_packed_fr.hpp"
+
 #include <barretenberg/crypto/blake2s/blake2s.hpp>
 #include <barretenberg/crypto/blake3s/blake3s.hpp>
 #include <barretenberg/crypto/ecdsa/ecdsa.hpp>
@@ -56,16 +60,18 @@ struct NativeTypes {
 
     /// TODO: lots of these compress / commit functions aren't actually used: remove them.
 
-    // Define the 'native' version of the function `compress`, with the name `compress`:
+    // Define the 'native' version of the function `compress`, with the name `compress`.
+    // Same result as `crypto::pedersen_commitment::compress_native`, with precomputed tables per generator (see
+    // fixed_base_pedersen.hpp).
     static fr compress(const std::vector<fr>& inputs, const size_t hash_index = 0)
     {
-        return crypto::pedersen_commitment::compress_native(inputs, hash_index);
+        return fixed_base_pedersen::compress(inputs, hash_index);
     }
 
+    // Prefer this overload where the number of inputs is fixed: it does not allocate.
     template <size_t SIZE> static fr compress(std::array<fr, SIZE> const& inputs, const size_t hash_index = 0)
     {
-        std::vector<fr> const inputs_vec(std::begin(inputs), std::end(inputs));
-        return crypto::pedersen_commitment::compress_native(inputs_vec, hash_index);
+        return fixed_base_pedersen::compress(inputs, hash_index);
     }
 
     static fr compress(const std::vector<std::pair<fr, crypto::generators::generator_index_t>>& input_pairs)
@@ -90,6 +96,18 @@ struct NativeTypes {
         return crypto::pedersen_hash::lookup::hash_multiple({ left, right }, 0);
     }
 
+    /**
+     * @brief Write `merkle_hash(left, right)` of every (left, right) pair of `children` (flattened) to `parents`, e.g.
+     * a whole layer of a tree. `parents` may be the front of `children`, to hash a layer in place.
+     *
+     * @details Converting each hash's points to affine form takes a field inversion. The batch shares one inversion
+     * per step across its pairs (see batched_pedersen_lookup.hpp), so prefer this to a loop of `merkle_hash`.
+     */
+    static void merkle_hash_batch(std::span<fr const> children, std::span<fr> parents)
+    {
+        batched_pedersen_lookup::merkle_hash_batch(children, parents);
+    }
+
     static grumpkin_point commit(const std::vector<fr>& inputs, const size_t hash_index = 0)
     {
         return crypto::pedersen_commitment::commit_native(inputs, hash_index);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "serialized_size.hpp"
+
+#include <barretenberg/common/serialize.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief Serialize `value` to the caller's buffer `buf` of `capacity` bytes, if it fits
+ *
+ * @details For the `*__sim_into` cbinds, whose host reuses one buffer for every call rather than freeing a buffer
+ * allocated for each result. The host passes its buffer and its capacity, and reads the size of the result: if it
+ * exceeds the capacity nothing was written, and the host calls again with a buffer at least that large. Results of a
+ * circuit have the same size for inputs of the same shape, so this happens on the first call only.
+ *
+ * Values of a fixed serialized size are encoded in `buf` directly. Others are serialized to a scratch vector of the
+ * calling thread, which keeps its allocation from one call to the next, then copied to `buf`.
+ *
+ * @return The serialized size of `value`
+ */
+template <typename T> size_t write_to_buffer(T const& value, uint8_t* buf, size_t capacity)
+{
+    using serialize::write;
+
+    if constexpr (FixedSizeSerializable<T>) {
+        constexpr size_t size = serialized_size<T>();
+        if (size <= capacity) {
+            write_fixed<T>(std::span<uint8_t, size>(buf, size), value);
+        }
+        return size;
+    }
+
+    thread_local std::vector<uint8_t> scratch;
+    scratch.clear();
+    write(scratch, value);
+    if (scratch.size() <= capacity) {
+        memcpy(buf, scratch.data(), scratch.size());
+    }
+    return scratch.size();
+}
+
+}  // namespace aztec3::utils
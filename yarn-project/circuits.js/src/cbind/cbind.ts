@@ -1,4 +1,5 @@
 import { CircuitsWasm } from '../wasm/index.js';
+import { Tuple } from '@aztec/foundation/serialize';
 import { decode, encode } from '@msgpack/msgpack';
 
 /**
@@ -82,3 +83,23 @@ export async function callCbind(wasm: CircuitsWasm, cbind: string, input: any[])
   wasm.call('bbfree', outputMsgpackPtr);
   return result;
 }
+
+/**
+ * Splits a buffer packing an array of fixed-size elements (see msgpack_packed_fr.hpp) into its elements.
+ * The elements are views into the buffer, without copies.
+ *
+ * @param buf - The packed buffer.
+ * @param elementSize - The size in bytes of each element.
+ * @param length - The number of elements of the array.
+ * @returns The elements of the array.
+ */
+export function unpackBuffers<N extends number>(buf: Buffer, elementSize: number, length: N): Tuple<Buffer, N> {
+  if (buf.length !== length * elementSize) {
+    throw new Error(`Packed buffer of ${buf.length} bytes is not ${length} ${elementSize}-byte elements`);
+  }
+  const elements: Buffer[] = [];
+  for (let offset = 0; offset < buf.length; offset += elementSize) {
+    elements.push(buf.subarray(offset, offset + elementSize));
+  }
+  return elements as Tuple<Buffer, N>;
+}
@@ -1,7 +1,7 @@
 /* eslint-disable */
 // GENERATED FILE DO NOT EDIT, RUN yarn remake-bindings
 import { Buffer } from 'buffer';
-import { callCbind } from './cbind.js';
+import { callCbind, unpackBuffers } from './cbind.js';
 import { CircuitsWasm } from '../wasm/index.js';
 import {
   Address,
@@ -34,6 +34,11 @@ import {
   CircuitError,
   isCircuitError,
   ProverBasePtr,
+  SimBatchResult,
+  PublicKernelTxResult,
+  LruCacheStats,
+  HashCacheStats,
+  HashCacheCapacities,
 } from './types.js';
 import { Tuple, mapTuple } from '@aztec/foundation/serialize';
 import mapValues from 'lodash.mapvalues';
@@ -202,7 +207,7 @@ export function fromFunctionData(o: FunctionData): MsgpackFunctionData {
 interface MsgpackOptionallyRevealedData {
   call_stack_item_hash: Buffer;
   function_data: MsgpackFunctionData;
-  emitted_events: Tuple<Buffer, 4>;
+  emitted_events: Buffer;
   vk_hash: Buffer;
   portal_contract_address: Buffer;
   pay_fee_from_l1: boolean;
@@ -242,7 +247,7 @@ export function toOptionallyRevealedData(o: MsgpackOptionallyRevealedData): Opti
   return new OptionallyRevealedData(
     Fr.fromBuffer(o.call_stack_item_hash),
     toFunctionData(o.function_data),
-    mapTuple(o.emitted_events, (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.emitted_events, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
     Fr.fromBuffer(o.vk_hash),
     Address.fromBuffer(o.portal_contract_address),
     o.pay_fee_from_l1,
@@ -283,7 +288,7 @@ export function fromOptionallyRevealedData(o: OptionallyRevealedData): MsgpackOp
   return {
     call_stack_item_hash: o.callStackItemHash.toBuffer(),
     function_data: fromFunctionData(o.functionData),
-    emitted_events: mapTuple(o.emittedEvents, (v: Fr) => v.toBuffer()),
+    emitted_events: Buffer.concat(mapTuple(o.emittedEvents, (v: Fr) => v.toBuffer())),
     vk_hash: o.vkHash.toBuffer(),
     portal_contract_address: o.portalContractAddress.toBuffer(),
     pay_fee_from_l1: o.payFeeFromL1,
@@ -363,11 +368,11 @@ export function fromPublicDataRead(o: PublicDataRead): MsgpackPublicDataRead {
 
 interface MsgpackCombinedAccumulatedData {
   aggregation_object: MsgpackNativeAggregationState;
-  new_commitments: Tuple<Buffer, 4>;
-  new_nullifiers: Tuple<Buffer, 4>;
-  private_call_stack: Tuple<Buffer, 8>;
-  public_call_stack: Tuple<Buffer, 8>;
-  new_l2_to_l1_msgs: Tuple<Buffer, 2>;
+  new_commitments: Buffer;
+  new_nullifiers: Buffer;
+  private_call_stack: Buffer;
+  public_call_stack: Buffer;
+  new_l2_to_l1_msgs: Buffer;
   new_contracts: Tuple<MsgpackNewContractData, 1>;
   optionally_revealed_data: Tuple<MsgpackOptionallyRevealedData, 4>;
   public_data_update_requests: Tuple<MsgpackPublicDataUpdateRequest, 4>;
@@ -407,11 +412,11 @@ export function toCombinedAccumulatedData(o: MsgpackCombinedAccumulatedData): Co
   }
   return new CombinedAccumulatedData(
     toNativeAggregationState(o.aggregation_object),
-    mapTuple(o.new_commitments, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.new_nullifiers, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.private_call_stack, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.public_call_stack, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.new_l2_to_l1_msgs, (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.new_commitments, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.new_nullifiers, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.private_call_stack, 32, 8), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.public_call_stack, 32, 8), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.new_l2_to_l1_msgs, 32, 2), (v: Buffer) => Fr.fromBuffer(v)),
     mapTuple(o.new_contracts, (v: MsgpackNewContractData) => toNewContractData(v)),
     mapTuple(o.optionally_revealed_data, (v: MsgpackOptionallyRevealedData) => toOptionallyRevealedData(v)),
     mapTuple(o.public_data_update_requests, (v: MsgpackPublicDataUpdateRequest) => toPublicDataUpdateRequest(v)),
@@ -452,11 +457,11 @@ export function fromCombinedAccumulatedData(o: CombinedAccumulatedData): Msgpack
   }
   return {
     aggregation_object: fromNativeAggregationState(o.aggregationObject),
-    new_commitments: mapTuple(o.newCommitments, (v: Fr) => v.toBuffer()),
-    new_nullifiers: mapTuple(o.newNullifiers, (v: Fr) => v.toBuffer()),
-    private_call_stack: mapTuple(o.privateCallStack, (v: Fr) => v.toBuffer()),
-    public_call_stack: mapTuple(o.publicCallStack, (v: Fr) => v.toBuffer()),
-    new_l2_to_l1_msgs: mapTuple(o.newL2ToL1Msgs, (v: Fr) => v.toBuffer()),
+    new_commitments: Buffer.concat(mapTuple(o.newCommitments, (v: Fr) => v.toBuffer())),
+    new_nullifiers: Buffer.concat(mapTuple(o.newNullifiers, (v: Fr) => v.toBuffer())),
+    private_call_stack: Buffer.concat(mapTuple(o.privateCallStack, (v: Fr) => v.toBuffer())),
+    public_call_stack: Buffer.concat(mapTuple(o.publicCallStack, (v: Fr) => v.toBuffer())),
+    new_l2_to_l1_msgs: Buffer.concat(mapTuple(o.newL2ToL1Msgs, (v: Fr) => v.toBuffer())),
     new_contracts: mapTuple(o.newContracts, (v: NewContractData) => fromNewContractData(v)),
     optionally_revealed_data: mapTuple(o.optionallyRevealedData, (v: OptionallyRevealedData) =>
       fromOptionallyRevealedData(v),
@@ -784,7 +789,7 @@ interface MsgpackPreviousKernelData {
   proof: Buffer;
   vk: MsgpackVerificationKeyData;
   vk_index: number;
-  vk_path: Tuple<Buffer, 3>;
+  vk_path: Buffer;
 }
 
 export function toPreviousKernelData(o: MsgpackPreviousKernelData): PreviousKernelData {
@@ -808,7 +813,7 @@ export function toPreviousKernelData(o: MsgpackPreviousKernelData): PreviousKern
     Proof.fromMsgpackBuffer(o.proof),
     toVerificationKeyData(o.vk),
     o.vk_index,
-    mapTuple(o.vk_path, (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.vk_path, 32, 3), (v: Buffer) => Fr.fromBuffer(v)),
   );
 }
 
@@ -833,7 +838,7 @@ export function fromPreviousKernelData(o: PreviousKernelData): MsgpackPreviousKe
     proof: o.proof.toMsgpackBuffer(),
     vk: fromVerificationKeyData(o.vk),
     vk_index: o.vkIndex,
-    vk_path: mapTuple(o.vkPath, (v: Fr) => v.toBuffer()),
+    vk_path: Buffer.concat(mapTuple(o.vkPath, (v: Fr) => v.toBuffer())),
   };
 }
 
@@ -974,13 +979,13 @@ export function fromContractStorageRead(o: ContractStorageRead): MsgpackContract
 
 interface MsgpackPublicCircuitPublicInputs {
   call_context: MsgpackCallContext;
-  args: Tuple<Buffer, 8>;
-  return_values: Tuple<Buffer, 4>;
-  emitted_events: Tuple<Buffer, 4>;
+  args: Buffer;
+  return_values: Buffer;
+  emitted_events: Buffer;
   contract_storage_update_requests: Tuple<MsgpackContractStorageUpdateRequest, 4>;
   contract_storage_reads: Tuple<MsgpackContractStorageRead, 4>;
-  public_call_stack: Tuple<Buffer, 4>;
-  new_l2_to_l1_msgs: Tuple<Buffer, 2>;
+  public_call_stack: Buffer;
+  new_l2_to_l1_msgs: Buffer;
   historic_public_data_tree_root: Buffer;
   prover_address: Buffer;
 }
@@ -1018,15 +1023,15 @@ export function toPublicCircuitPublicInputs(o: MsgpackPublicCircuitPublicInputs)
   }
   return new PublicCircuitPublicInputs(
     toCallContext(o.call_context),
-    mapTuple(o.args, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.return_values, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.emitted_events, (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.args, 32, 8), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.return_values, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.emitted_events, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
     mapTuple(o.contract_storage_update_requests, (v: MsgpackContractStorageUpdateRequest) =>
       toContractStorageUpdateRequest(v),
     ),
     mapTuple(o.contract_storage_reads, (v: MsgpackContractStorageRead) => toContractStorageRead(v)),
-    mapTuple(o.public_call_stack, (v: Buffer) => Fr.fromBuffer(v)),
-    mapTuple(o.new_l2_to_l1_msgs, (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.public_call_stack, 32, 4), (v: Buffer) => Fr.fromBuffer(v)),
+    mapTuple(unpackBuffers(o.new_l2_to_l1_msgs, 32, 2), (v: Buffer) => Fr.fromBuffer(v)),
     Fr.fromBuffer(o.historic_public_data_tree_root),
     Address.fromBuffer(o.prover_address),
   );
@@ -1065,15 +1070,15 @@ export function fromPublicCircuitPublicInputs(o: PublicCircuitPublicInputs): Msg
   }
   return {
     call_context: fromCallContext(o.callContext),
-    args: mapTuple(o.args, (v: Fr) => v.toBuffer()),
-    return_values: mapTuple(o.returnValues, (v: Fr) => v.toBuffer()),
-    emitted_events: mapTuple(o.emittedEvents, (v: Fr) => v.toBuffer()),
+    args: Buffer.concat(mapTuple(o.args, (v: Fr) => v.toBuffer())),
+    return_values: Buffer.concat(mapTuple(o.returnValues, (v: Fr) => v.toBuffer())),
+    emitted_events: Buffer.concat(mapTuple(o.emittedEvents, (v: Fr) => v.toBuffer())),
     contract_storage_update_requests: mapTuple(o.contractStorageUpdateRequests, (v: ContractStorageUpdateRequest) =>
       fromContractStorageUpdateRequest(v),
     ),
     contract_storage_reads: mapTuple(o.contractStorageReads, (v: ContractStorageRead) => fromContractStorageRead(v)),
-    public_call_stack: mapTuple(o.publicCallStack, (v: Fr) => v.toBuffer()),
-    new_l2_to_l1_msgs: mapTuple(o.newL2ToL1Msgs, (v: Fr) => v.toBuffer()),
+    public_call_stack: Buffer.concat(mapTuple(o.publicCallStack, (v: Fr) => v.toBuffer())),
+    new_l2_to_l1_msgs: Buffer.concat(mapTuple(o.newL2ToL1Msgs, (v: Fr) => v.toBuffer())),
     historic_public_data_tree_root: o.historicPublicDataTreeRoot.toBuffer(),
     prover_address: o.proverAddress.toBuffer(),
   };
@@ -1244,6 +1249,189 @@ export function fromCircuitError(o: CircuitError): MsgpackCircuitError {
   };
 }
 
+interface MsgpackSimBatchResult {
+  public_inputs: MsgpackKernelCircuitPublicInputs;
+  failure: MsgpackCircuitError;
+}
+
+export function toSimBatchResult(o: MsgpackSimBatchResult): SimBatchResult {
+  if (o.public_inputs === undefined) {
+    throw new Error('Expected public_inputs in SimBatchResult deserialization');
+  }
+  if (o.failure === undefined) {
+    throw new Error('Expected failure in SimBatchResult deserialization');
+  }
+  return new SimBatchResult(toKernelCircuitPublicInputs(o.public_inputs), toCircuitError(o.failure));
+}
+
+export function fromSimBatchResult(o: SimBatchResult): MsgpackSimBatchResult {
+  if (o.publicInputs === undefined) {
+    throw new Error('Expected publicInputs in SimBatchResult serialization');
+  }
+  if (o.failure === undefined) {
+    throw new Error('Expected failure in SimBatchResult serialization');
+  }
+  return {
+    public_inputs: fromKernelCircuitPublicInputs(o.publicInputs),
+    failure: fromCircuitError(o.failure),
+  };
+}
+
+interface MsgpackPublicKernelTxResult {
+  public_inputs: MsgpackKernelCircuitPublicInputs;
+  failures: MsgpackCircuitError[];
+}
+
+export function toPublicKernelTxResult(o: MsgpackPublicKernelTxResult): PublicKernelTxResult {
+  if (o.public_inputs === undefined) {
+    throw new Error('Expected public_inputs in PublicKernelTxResult deserialization');
+  }
+  if (o.failures === undefined) {
+    throw new Error('Expected failures in PublicKernelTxResult deserialization');
+  }
+  return new PublicKernelTxResult(
+    toKernelCircuitPublicInputs(o.public_inputs),
+    o.failures.map((v: MsgpackCircuitError) => toCircuitError(v)),
+  );
+}
+
+export function fromPublicKernelTxResult(o: PublicKernelTxResult): MsgpackPublicKernelTxResult {
+  if (o.publicInputs === undefined) {
+    throw new Error('Expected publicInputs in PublicKernelTxResult serialization');
+  }
+  if (o.failures === undefined) {
+    throw new Error('Expected failures in PublicKernelTxResult serialization');
+  }
+  return {
+    public_inputs: fromKernelCircuitPublicInputs(o.publicInputs),
+    failures: o.failures.map((v: CircuitError) => fromCircuitError(v)),
+  };
+}
+
+interface MsgpackLruCacheStats {
+  hits: number;
+  misses: number;
+  evictions: number;
+  size: number;
+  capacity: number;
+}
+
+export function toLruCacheStats(o: MsgpackLruCacheStats): LruCacheStats {
+  if (o.hits === undefined) {
+    throw new Error('Expected hits in LruCacheStats deserialization');
+  }
+  if (o.misses === undefined) {
+    throw new Error('Expected misses in LruCacheStats deserialization');
+  }
+  if (o.evictions === undefined) {
+    throw new Error('Expected evictions in LruCacheStats deserialization');
+  }
+  if (o.size === undefined) {
+    throw new Error('Expected size in LruCacheStats deserialization');
+  }
+  if (o.capacity === undefined) {
+    throw new Error('Expected capacity in LruCacheStats deserialization');
+  }
+  return new LruCacheStats(o.hits, o.misses, o.evictions, o.size, o.capacity);
+}
+
+export function fromLruCacheStats(o: LruCacheStats): MsgpackLruCacheStats {
+  if (o.hits === undefined) {
+    throw new Error('Expected hits in LruCacheStats serialization');
+  }
+  if (o.misses === undefined) {
+    throw new Error('Expected misses in LruCacheStats serialization');
+  }
+  if (o.evictions === undefined) {
+    throw new Error('Expected evictions in LruCacheStats serialization');
+  }
+  if (o.size === undefined) {
+    throw new Error('Expected size in LruCacheStats serialization');
+  }
+  if (o.capacity === undefined) {
+    throw new Error('Expected capacity in LruCacheStats serialization');
+  }
+  return {
+    hits: o.hits,
+    misses: o.misses,
+    evictions: o.evictions,
+    size: o.size,
+    capacity: o.capacity,
+  };
+}
+
+interface MsgpackHashCacheStats {
+  public_data_tree_index: MsgpackLruCacheStats;
+  silo: MsgpackLruCacheStats;
+  vk: MsgpackLruCacheStats;
+}
+
+export function toHashCacheStats(o: MsgpackHashCacheStats): HashCacheStats {
+  if (o.public_data_tree_index === undefined) {
+    throw new Error('Expected public_data_tree_index in HashCacheStats deserialization');
+  }
+  if (o.silo === undefined) {
+    throw new Error('Expected silo in HashCacheStats deserialization');
+  }
+  if (o.vk === undefined) {
+    throw new Error('Expected vk in HashCacheStats deserialization');
+  }
+  return new HashCacheStats(toLruCacheStats(o.public_data_tree_index), toLruCacheStats(o.silo), toLruCacheStats(o.vk));
+}
+
+export function fromHashCacheStats(o: HashCacheStats): MsgpackHashCacheStats {
+  if (o.publicDataTreeIndex === undefined) {
+    throw new Error('Expected publicDataTreeIndex in HashCacheStats serialization');
+  }
+  if (o.silo === undefined) {
+    throw new Error('Expected silo in HashCacheStats serialization');
+  }
+  if (o.vk === undefined) {
+    throw new Error('Expected vk in HashCacheStats serialization');
+  }
+  return {
+    public_data_tree_index: fromLruCacheStats(o.publicDataTreeIndex),
+    silo: fromLruCacheStats(o.silo),
+    vk: fromLruCacheStats(o.vk),
+  };
+}
+
+interface MsgpackHashCacheCapacities {
+  public_data_tree_index: number;
+  silo: number;
+  vk: number;
+}
+
+export function toHashCacheCapacities(o: MsgpackHashCacheCapacities): HashCacheCapacities {
+  if (o.public_data_tree_index === undefined) {
+    throw new Error('Expected public_data_tree_index in HashCacheCapacities deserialization');
+  }
+  if (o.silo === undefined) {
+    throw new Error('Expected silo in HashCacheCapacities deserialization');
+  }
+  if (o.vk === undefined) {
+    throw new Error('Expected vk in HashCacheCapacities deserialization');
+  }
+  return new HashCacheCapacities(o.public_data_tree_index, o.silo, o.vk);
+}
+
+export function fromHashCacheCapacities(o: HashCacheCapacities): MsgpackHashCacheCapacities {
+  if (o.publicDataTreeIndex === undefined) {
+    throw new Error('Expected publicDataTreeIndex in HashCacheCapacities serialization');
+  }
+  if (o.silo === undefined) {
+    throw new Error('Expected silo in HashCacheCapacities serialization');
+  }
+  if (o.vk === undefined) {
+    throw new Error('Expected vk in HashCacheCapacities serialization');
+  }
+  return {
+    public_data_tree_index: o.publicDataTreeIndex,
+    silo: o.silo,
+    vk: o.vk,
+  };
+}
+
 export async function abisComputeContractAddress(
   wasm: CircuitsWasm,
   arg0: Address,
@@ -1275,3 +1463,47 @@ export async function publicKernelSim(
 export async function proverProcessQueue2(wasm: CircuitsWasm, arg0: ProverBasePtr): Promise<number> {
   return await callCbind(wasm, 'prover_process_queue2', [arg0]);
 }
+export async function publicKernelSimFailFast(
+  wasm: CircuitsWasm,
+  arg0: PublicKernelInputs,
+): Promise<CircuitError | KernelCircuitPublicInputs> {
+  return ((v: MsgpackCircuitError | MsgpackKernelCircuitPublicInputs) =>
+    isCircuitError(v) ? toCircuitError(v) : toKernelCircuitPublicInputs(v))(
+    await callCbind(wasm, 'public_kernel__sim_fail_fast', [fromPublicKernelInputs(arg0)]),
+  );
+}
+export async function publicKernelSimBatch(wasm: CircuitsWasm, arg0: PublicKernelInputs[]): Promise<SimBatchResult[]> {
+  return (
+    await callCbind(wasm, 'public_kernel__sim_batch', [arg0.map((v: PublicKernelInputs) => fromPublicKernelInputs(v))])
+  ).map((v: MsgpackSimBatchResult) => toSimBatchResult(v));
+}
+export async function publicKernelSimTx(
+  wasm: CircuitsWasm,
+  arg0: PreviousKernelData,
+  arg1: PublicCallData[],
+): Promise<PublicKernelTxResult> {
+  return toPublicKernelTxResult(
+    await callCbind(wasm, 'public_kernel__sim_tx', [
+      fromPreviousKernelData(arg0),
+      arg1.map((v: PublicCallData) => fromPublicCallData(v)),
+    ]),
+  );
+}
+export async function publicKernelSimTxFailFast(
+  wasm: CircuitsWasm,
+  arg0: PreviousKernelData,
+  arg1: PublicCallData[],
+): Promise<PublicKernelTxResult> {
+  return toPublicKernelTxResult(
+    await callCbind(wasm, 'public_kernel__sim_tx_fail_fast', [
+      fromPreviousKernelData(arg0),
+      arg1.map((v: PublicCallData) => fromPublicCallData(v)),
+    ]),
+  );
+}
+export async function abisGetHashCacheStats(wasm: CircuitsWasm): Promise<HashCacheStats> {
+  return toHashCacheStats(await callCbind(wasm, 'abis__get_hash_cache_stats', []));
+}
+export async function abisSetHashCacheCapacity(wasm: CircuitsWasm, arg0: HashCacheCapacities): Promise<HashCacheStats> {
+  return toHashCacheStats(await callCbind(wasm, 'abis__set_hash_cache_capacity', [fromHashCacheCapacities(arg0)]));
+}
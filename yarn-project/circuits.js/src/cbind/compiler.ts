@@ -23,6 +23,7 @@ type ObjectSchema = { [key: string]: Schema };
  * Represents the various data structures and types used to model schema definitions.
  * The Schema type supports primitive types, object schemas, tuples, maps, optional values,
  * fixed-size arrays, shared pointers, and custom type aliases (defined in schema_map_impl.hpp).
+ * Arrays of fields wrapped by msgpack_packed are packed as one buffer of their elements (msgpack_packed_fr.hpp).
  */
 type Schema =
   | string
@@ -34,6 +35,7 @@ type Schema =
   | ['variant', Schema[]]
   | ['shared_ptr', [Schema]]
   | ['array', [Schema, number]]
+  | ['packed_array', [Schema, number]]
   | ['alias', [string, string]];
 
 /**
@@ -72,6 +74,15 @@ export interface TypeInfo {
    * If so, stores the array's subtype elements.
    */
   arraySubtype?: TypeInfo;
+  /**
+   * Indicates if the schema represents a fixed-size array packed as one buffer of its elements.
+   * If so, stores the size in bytes of each element.
+   */
+  packedElementSize?: number;
+  /**
+   * The number of elements of a packed fixed-size array.
+   */
+  packedLength?: number;
   /**
    * Indicates if the schama represents a variant.
    * If so, stores the variant's subtype elements.
@@ -106,6 +117,23 @@ export interface TypeInfo {
   toMsgpackMethod?: string;
 }
 
+/**
+ * Get the size in bytes of the elements of a packed array, which are aliases of a fixed-size msgpack bin.
+ *
+ * @param schema - The schema of the elements.
+ * @returns The size of each element.
+ */
+function getPackedElementSize(schema: Schema): number {
+  if (Array.isArray(schema) && schema[0] === 'alias') {
+    const [_alias, [_typeName, msgpackName]] = schema;
+    const match = /^bin(\d+)$/.exec(msgpackName);
+    if (match) {
+      return Number(match[1]);
+    }
+  }
+  throw new Error('Unsupported packed element type ' + JSON.stringify(schema));
+}
+
 /**
  * Generate a JavaScript expression to convert a given value from its Msgpack type representation to its
  * corresponding TypeScript type representation using the provided TypeInfo.
@@ -125,6 +153,9 @@ function msgpackConverterExpr(typeInfo: TypeInfo, value: string): string {
       return `${value} as ${typeName}`;
     }
     return `${typeName}.fromBuffer(${value})`;
+  } else if (typeInfo.packedElementSize) {
+    const convFn = `(v: Buffer) => ${msgpackConverterExpr(typeInfo.arraySubtype!, 'v')}`;
+    return `mapTuple(unpackBuffers(${value}, ${typeInfo.packedElementSize}, ${typeInfo.packedLength}), ${convFn})`;
   } else if (typeInfo.arraySubtype) {
     const { typeName, msgpackTypeName } = typeInfo.arraySubtype;
     const convFn = `(v: ${msgpackTypeName || typeName}) => ${msgpackConverterExpr(typeInfo.arraySubtype, 'v')}`;
@@ -179,11 +210,8 @@ function classConverterExpr(typeInfo: TypeInfo, value: string): string {
   } else if (typeInfo.arraySubtype) {
     const { typeName } = typeInfo.arraySubtype;
     const convFn = `(v: ${typeName}) => ${classConverterExpr(typeInfo.arraySubtype, 'v')}`;
-    if (typeInfo.isTuple) {
-      return `mapTuple(${value}, ${convFn})`;
-    } else {
-      return `${value}.map(${convFn})`;
-    }
+    const elements = typeInfo.isTuple ? `mapTuple(${value}, ${convFn})` : `${value}.map(${convFn})`;
+    return typeInfo.packedElementSize ? `Buffer.concat(${elements})` : elements;
   } else if (typeInfo.variantSubtypes) {
     throw new Error('TODO - variant parameters to C++ not yet supported');
   } else if (typeInfo.mapSubtypes) {
@@ -235,6 +263,17 @@ export class CbindCompiler {
           isTuple: true,
           arraySubtype: this.getTypeInfo(subtype),
         };
+      } else if (type[0] === 'packed_array') {
+        // fixed-size array packed as one buffer of its elements
+        const [_packedArray, [subtype, size]] = type;
+        return {
+          typeName: `Tuple<${this.getTypeName(subtype)}, ${size}>`,
+          msgpackTypeName: 'Buffer',
+          isTuple: true,
+          arraySubtype: this.getTypeInfo(subtype),
+          packedElementSize: getPackedElementSize(subtype),
+          packedLength: size,
+        };
       } else if (type[0] === 'variant') {
         // fixed-size array case
         const [_array, variantSchemas] = type;
@@ -481,7 +520,7 @@ return ${msgpackConverterExpr(retType, innerCall)};
 /* eslint-disable */
 // GENERATED FILE DO NOT EDIT, RUN yarn remake-bindings
 import { Buffer } from "buffer";
-import { callCbind } from './cbind.js';
+import { callCbind, unpackBuffers } from './cbind.js';
 import { CircuitsWasm } from '../wasm/index.js';
 `,
     ];
@@ -31,6 +31,11 @@ export {
   PublicCallData,
   PublicKernelInputs,
   CircuitError,
+  SimBatchResult,
+  PublicKernelTxResult,
+  LruCacheStats,
+  HashCacheStats,
+  HashCacheCapacities,
 } from '../structs/index.js';
 
 /**
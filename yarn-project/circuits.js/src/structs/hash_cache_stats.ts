@@ -0,0 +1,67 @@
+/**
+ * The counters of one process-wide cache of native hashes.
+ */
+export class LruCacheStats {
+  constructor(
+    /**
+     * The number of lookups that found their hash in the cache.
+     */
+    public readonly hits: number,
+    /**
+     * The number of lookups that computed their hash.
+     */
+    public readonly misses: number,
+    /**
+     * The number of entries dropped to make room for new ones.
+     */
+    public readonly evictions: number,
+    /**
+     * The number of entries in the cache.
+     */
+    public readonly size: number,
+    /**
+     * The maximum number of entries of the cache.
+     */
+    public readonly capacity: number,
+  ) {}
+}
+
+/**
+ * The counters of each process-wide cache of native hashes of the circuits wasm.
+ */
+export class HashCacheStats {
+  constructor(
+    /**
+     * The cache of public data tree indices.
+     */
+    public readonly publicDataTreeIndex: LruCacheStats,
+    /**
+     * The cache of siloed commitments and nullifiers.
+     */
+    public readonly silo: LruCacheStats,
+    /**
+     * The cache of verification key hashes.
+     */
+    public readonly vk: LruCacheStats,
+  ) {}
+}
+
+/**
+ * The number of entries of each process-wide cache of native hashes of the circuits wasm.
+ */
+export class HashCacheCapacities {
+  constructor(
+    /**
+     * The capacity of the cache of public data tree indices.
+     */
+    public readonly publicDataTreeIndex: number,
+    /**
+     * The capacity of the cache of siloed commitments and nullifiers.
+     */
+    public readonly silo: number,
+    /**
+     * The capacity of the cache of verification key hashes, whose entries each hold a whole serialized key.
+     */
+    public readonly vk: number,
+  ) {}
+}
@@ -14,6 +14,8 @@ import { PreviousKernelData } from './previous_kernel_data.js';
 import { CombinedHistoricTreeRoots } from './combined_constant_data.js';
 import { Proof } from '../proof.js';
 import { Tuple } from '@aztec/foundation/serialize';
+import { CircuitError } from '../circuit_error.js';
+import { KernelCircuitPublicInputs } from './public_inputs.js';
 
 /**
  * Inputs to the public kernel circuit.
@@ -140,3 +142,35 @@ export class PublicCallData {
     );
   }
 }
+
+/**
+ * The result of one public kernel iteration of a batch (`public_kernel__sim_batch`).
+ */
+export class SimBatchResult {
+  constructor(
+    /**
+     * The public inputs of the iteration.
+     */
+    public readonly publicInputs: KernelCircuitPublicInputs,
+    /**
+     * The first failure of the iteration, with code 0 if it passed.
+     */
+    public readonly failure: CircuitError,
+  ) {}
+}
+
+/**
+ * The result of the public kernel iterations of every public call of a transaction (`public_kernel__sim_tx`).
+ */
+export class PublicKernelTxResult {
+  constructor(
+    /**
+     * The public inputs of the last iteration run.
+     */
+    public readonly publicInputs: KernelCircuitPublicInputs,
+    /**
+     * The first failure of each iteration run, with code 0 if it passed, in the order of the calls.
+     */
+    public readonly failures: CircuitError[],
+  ) {}
+}